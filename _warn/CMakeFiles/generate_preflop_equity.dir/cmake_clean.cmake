@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_preflop_equity.dir/tools/generate_preflop_equity.cpp.o"
+  "CMakeFiles/generate_preflop_equity.dir/tools/generate_preflop_equity.cpp.o.d"
+  "generate_preflop_equity"
+  "generate_preflop_equity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_preflop_equity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
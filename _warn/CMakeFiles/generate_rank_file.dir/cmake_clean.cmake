@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/generate_rank_file.dir/tools/generate_rank_file.cpp.o"
+  "CMakeFiles/generate_rank_file.dir/tools/generate_rank_file.cpp.o.d"
+  "generate_rank_file"
+  "generate_rank_file.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/generate_rank_file.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
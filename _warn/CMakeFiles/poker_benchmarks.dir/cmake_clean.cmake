@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poker_benchmarks.dir/benchmarks/poker_benchmarks.cpp.o"
+  "CMakeFiles/poker_benchmarks.dir/benchmarks/poker_benchmarks.cpp.o.d"
+  "poker_benchmarks"
+  "poker_benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poker_benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poker_computer_strategy_tests.dir/tests/poker_computer_strategy_test.cpp.o"
+  "CMakeFiles/poker_computer_strategy_tests.dir/tests/poker_computer_strategy_test.cpp.o.d"
+  "poker_computer_strategy_tests"
+  "poker_computer_strategy_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poker_computer_strategy_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poker_engine_tests.dir/tests/poker_engine_tests.cpp.o"
+  "CMakeFiles/poker_engine_tests.dir/tests/poker_engine_tests.cpp.o.d"
+  "poker_engine_tests"
+  "poker_engine_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poker_engine_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/board_texture.cpp" "CMakeFiles/poker_game.dir/board_texture.cpp.o" "gcc" "CMakeFiles/poker_game.dir/board_texture.cpp.o.d"
+  "/root/repo/card.cpp" "CMakeFiles/poker_game.dir/card.cpp.o" "gcc" "CMakeFiles/poker_game.dir/card.cpp.o.d"
+  "/root/repo/card_set.cpp" "CMakeFiles/poker_game.dir/card_set.cpp.o" "gcc" "CMakeFiles/poker_game.dir/card_set.cpp.o.d"
+  "/root/repo/computer_strategy.cpp" "CMakeFiles/poker_game.dir/computer_strategy.cpp.o" "gcc" "CMakeFiles/poker_game.dir/computer_strategy.cpp.o.d"
+  "/root/repo/deck.cpp" "CMakeFiles/poker_game.dir/deck.cpp.o" "gcc" "CMakeFiles/poker_game.dir/deck.cpp.o.d"
+  "/root/repo/equity_cache.cpp" "CMakeFiles/poker_game.dir/equity_cache.cpp.o" "gcc" "CMakeFiles/poker_game.dir/equity_cache.cpp.o.d"
+  "/root/repo/equity_calculator.cpp" "CMakeFiles/poker_game.dir/equity_calculator.cpp.o" "gcc" "CMakeFiles/poker_game.dir/equity_calculator.cpp.o.d"
+  "/root/repo/hand_indexer.cpp" "CMakeFiles/poker_game.dir/hand_indexer.cpp.o" "gcc" "CMakeFiles/poker_game.dir/hand_indexer.cpp.o.d"
+  "/root/repo/hand_range.cpp" "CMakeFiles/poker_game.dir/hand_range.cpp.o" "gcc" "CMakeFiles/poker_game.dir/hand_range.cpp.o.d"
+  "/root/repo/player.cpp" "CMakeFiles/poker_game.dir/player.cpp.o" "gcc" "CMakeFiles/poker_game.dir/player.cpp.o.d"
+  "/root/repo/poker_engine.cpp" "CMakeFiles/poker_game.dir/poker_engine.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_engine.cpp.o.d"
+  "/root/repo/poker_engine_state.cpp" "CMakeFiles/poker_game.dir/poker_engine_state.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_engine_state.cpp.o.d"
+  "/root/repo/poker_game.cpp" "CMakeFiles/poker_game.dir/poker_game.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_game.cpp.o.d"
+  "/root/repo/poker_hand.cpp" "CMakeFiles/poker_game.dir/poker_hand.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_hand.cpp.o.d"
+  "/root/repo/poker_hand_evaluation.cpp" "CMakeFiles/poker_game.dir/poker_hand_evaluation.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_hand_evaluation.cpp.o.d"
+  "/root/repo/poker_hand_evaluator.cpp" "CMakeFiles/poker_game.dir/poker_hand_evaluator.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_hand_evaluator.cpp.o.d"
+  "/root/repo/poker_hand_rank.cpp" "CMakeFiles/poker_game.dir/poker_hand_rank.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_hand_rank.cpp.o.d"
+  "/root/repo/poker_hand_rank_file.cpp" "CMakeFiles/poker_game.dir/poker_hand_rank_file.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_hand_rank_file.cpp.o.d"
+  "/root/repo/poker_simulator.cpp" "CMakeFiles/poker_game.dir/poker_simulator.cpp.o" "gcc" "CMakeFiles/poker_game.dir/poker_simulator.cpp.o.d"
+  "/root/repo/preflop_equity.cpp" "CMakeFiles/poker_game.dir/preflop_equity.cpp.o" "gcc" "CMakeFiles/poker_game.dir/preflop_equity.cpp.o.d"
+  "/root/repo/thread_pool.cpp" "CMakeFiles/poker_game.dir/thread_pool.cpp.o" "gcc" "CMakeFiles/poker_game.dir/thread_pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,51 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poker_game.dir/board_texture.cpp.o"
+  "CMakeFiles/poker_game.dir/board_texture.cpp.o.d"
+  "CMakeFiles/poker_game.dir/card.cpp.o"
+  "CMakeFiles/poker_game.dir/card.cpp.o.d"
+  "CMakeFiles/poker_game.dir/card_set.cpp.o"
+  "CMakeFiles/poker_game.dir/card_set.cpp.o.d"
+  "CMakeFiles/poker_game.dir/computer_strategy.cpp.o"
+  "CMakeFiles/poker_game.dir/computer_strategy.cpp.o.d"
+  "CMakeFiles/poker_game.dir/deck.cpp.o"
+  "CMakeFiles/poker_game.dir/deck.cpp.o.d"
+  "CMakeFiles/poker_game.dir/equity_cache.cpp.o"
+  "CMakeFiles/poker_game.dir/equity_cache.cpp.o.d"
+  "CMakeFiles/poker_game.dir/equity_calculator.cpp.o"
+  "CMakeFiles/poker_game.dir/equity_calculator.cpp.o.d"
+  "CMakeFiles/poker_game.dir/hand_indexer.cpp.o"
+  "CMakeFiles/poker_game.dir/hand_indexer.cpp.o.d"
+  "CMakeFiles/poker_game.dir/hand_range.cpp.o"
+  "CMakeFiles/poker_game.dir/hand_range.cpp.o.d"
+  "CMakeFiles/poker_game.dir/player.cpp.o"
+  "CMakeFiles/poker_game.dir/player.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_engine.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_engine.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_engine_state.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_engine_state.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_game.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_game.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_hand.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_hand.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_hand_evaluation.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_hand_evaluation.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_hand_evaluator.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_hand_evaluator.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_hand_rank.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_hand_rank.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_hand_rank_file.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_hand_rank_file.cpp.o.d"
+  "CMakeFiles/poker_game.dir/poker_simulator.cpp.o"
+  "CMakeFiles/poker_game.dir/poker_simulator.cpp.o.d"
+  "CMakeFiles/poker_game.dir/preflop_equity.cpp.o"
+  "CMakeFiles/poker_game.dir/preflop_equity.cpp.o.d"
+  "CMakeFiles/poker_game.dir/thread_pool.cpp.o"
+  "CMakeFiles/poker_game.dir/thread_pool.cpp.o.d"
+  "libpoker_game.a"
+  "libpoker_game.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poker_game.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
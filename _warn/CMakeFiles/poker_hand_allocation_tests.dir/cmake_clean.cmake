@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poker_hand_allocation_tests.dir/tests/poker_hand_allocation_tests.cpp.o"
+  "CMakeFiles/poker_hand_allocation_tests.dir/tests/poker_hand_allocation_tests.cpp.o.d"
+  "poker_hand_allocation_tests"
+  "poker_hand_allocation_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poker_hand_allocation_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poker_sim.dir/tools/poker_sim.cpp.o"
+  "CMakeFiles/poker_sim.dir/tools/poker_sim.cpp.o.d"
+  "poker_sim"
+  "poker_sim.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poker_sim.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_warn
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(poker_hand_evaluator_tests "/root/repo/_warn/poker_hand_evaluator_tests")
+set_tests_properties(poker_hand_evaluator_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;343;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(poker_hand_allocation_tests "/root/repo/_warn/poker_hand_allocation_tests")
+set_tests_properties(poker_hand_allocation_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;344;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(poker_engine_tests "/root/repo/_warn/poker_engine_tests")
+set_tests_properties(poker_engine_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;345;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(poker_computer_strategy_tests "/root/repo/_warn/poker_computer_strategy_tests")
+set_tests_properties(poker_computer_strategy_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;346;add_test;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1,286 @@
+#include "../board_texture.hpp"
+#include "../card.hpp"
+#include "../computer_strategy.hpp"
+#include "../deck.hpp"
+#include "../equity_calculator.hpp"
+#include "../hand_indexer.hpp"
+#include "../poker_engine.hpp"
+#include "../poker_hand_evaluator.hpp"
+#include "../poker_simulator.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+constexpr std::size_t RANDOM_DEAL_COUNT = 4096;
+
+struct Deal {
+    std::vector<const Card*> player1_cards;
+    std::vector<const Card*> player2_cards;
+    std::vector<const Card*> community_cards;
+};
+
+// Fixed set of random heads-up deals, so every run measures the same hands.
+const std::vector<Deal>& random_deals() {
+    static const std::vector<Deal> deals = [] {
+        std::vector<const Card*> deck;
+        for (Suit suit : suits) {
+            for (Rank rank : ranks) {
+                deck.push_back(Card::get_card(suit, rank));
+            }
+        }
+
+        std::mt19937 gen(42);
+        std::vector<Deal> result;
+        for (std::size_t i = 0; i < RANDOM_DEAL_COUNT; i++) {
+            std::shuffle(deck.begin(), deck.end(), gen);
+            result.push_back({{deck[0], deck[1]}, {deck[2], deck[3]}, {deck.begin() + 4, deck.begin() + 9}});
+        }
+        return result;
+    }();
+    return deals;
+}
+
+} // namespace
+
+static void BM_CardGetCard(benchmark::State& state) {
+    for (auto _ : state) {
+        for (Suit suit : suits) {
+            for (Rank rank : ranks) {
+                benchmark::DoNotOptimize(Card::get_card(suit, rank));
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * DECK_SIZE);
+}
+BENCHMARK(BM_CardGetCard);
+
+static void BM_DeckConstruction(benchmark::State& state) {
+    for (auto _ : state) {
+        Deck deck;
+        benchmark::DoNotOptimize(deck);
+    }
+}
+BENCHMARK(BM_DeckConstruction);
+
+// Cards of a heads-up hand: four hole cards, three burns and the board.
+static void BM_DeckShuffleAndDeal(benchmark::State& state) {
+    constexpr std::size_t HEADS_UP_CARDS = 12;
+    Deck deck(Xoshiro256(42));
+    for (auto _ : state) {
+        deck.shuffle();
+        for (std::size_t i = 0; i < HEADS_UP_CARDS; i++) {
+            benchmark::DoNotOptimize(deck.deal_card());
+        }
+    }
+}
+BENCHMARK(BM_DeckShuffleAndDeal);
+
+static void BM_EvaluateHand(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        benchmark::DoNotOptimize(PokerHandEvaluator::evaluate_hand(deal.player1_cards, deal.community_cards));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvaluateHand);
+
+static void BM_DetermineWinner(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        benchmark::DoNotOptimize(PokerHandEvaluator::determine_winner(
+            deal.player1_cards, deal.player2_cards, deal.community_cards));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DetermineWinner);
+
+static void BM_MediumStrategyGetNextMove(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const PokerEngineEnumState stage = static_cast<PokerEngineEnumState>(state.range(0));
+    const std::size_t community_card_count = stage == PokerEngineEnumState::Flop ? 3
+                                            : stage == PokerEngineEnumState::Turn ? 4
+                                            : stage == PokerEngineEnumState::River ? 5 : 0;
+
+    std::vector<GameState> game_states;
+    for (const Deal& deal : deals) {
+        GameState game_state{};
+        game_state.hands = deal.player2_cards;
+        game_state.community_cards.assign(deal.community_cards.begin(),
+                                          deal.community_cards.begin() + community_card_count);
+        game_state.stage = stage;
+        game_state.current_bet = 20;
+        game_state.pot_size = 100;
+        game_state.computer_chips = 1000;
+        game_states.push_back(game_state);
+    }
+
+    MediumStrategy medium_strategy;
+    ComputerStrategy& strategy = medium_strategy;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(strategy.get_next_move(game_states[i++ % game_states.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MediumStrategyGetNextMove)
+    ->ArgName("stage")
+    ->Arg(static_cast<int>(PokerEngineEnumState::PreFlop))
+    ->Arg(static_cast<int>(PokerEngineEnumState::Flop))
+    ->Arg(static_cast<int>(PokerEngineEnumState::Turn))
+    ->Arg(static_cast<int>(PokerEngineEnumState::River));
+
+static void BM_BoardTexture(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t community_card_count = state.range(0);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        std::vector<const Card*> community_cards(deal.community_cards.begin(),
+                                                 deal.community_cards.begin() + community_card_count);
+        benchmark::DoNotOptimize(BoardTextureAnalyzer::analyze(community_cards));
+    }
+}
+BENCHMARK(BM_BoardTexture)->ArgName("community_cards")->Arg(3)->Arg(4)->Arg(5)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void BM_HandIndex(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t community_card_count = state.range(0);
+    const HandIndexer& indexer = HandIndexer::for_board(community_card_count);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        CardSet community_cards(std::vector<const Card*>(deal.community_cards.begin(),
+                                                         deal.community_cards.begin() + community_card_count));
+        benchmark::DoNotOptimize(indexer.index(CardSet(deal.player1_cards), community_cards));
+    }
+}
+BENCHMARK(BM_HandIndex)->ArgName("community_cards")->Arg(0)->Arg(3)->Arg(4)->Arg(5);
+
+static void BM_HeadsUpEquity(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t community_card_count = state.range(0);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        std::vector<const Card*> community_cards(deal.community_cards.begin(),
+                                                 deal.community_cards.begin() + community_card_count);
+        benchmark::DoNotOptimize(EquityCalculator::heads_up_equity(deal.player1_cards, community_cards));
+    }
+}
+BENCHMARK(BM_HeadsUpEquity)->ArgName("community_cards")->Arg(3)->Arg(4)->Arg(5)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_SampledHeadsUpEquity(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t samples = state.range(0);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i % deals.size()];
+        benchmark::DoNotOptimize(EquityCalculator::sample_heads_up_equity(deal.player1_cards, {}, samples, i++));
+    }
+    state.SetItemsProcessed(state.iterations() * samples);
+}
+BENCHMARK(BM_SampledHeadsUpEquity)->ArgName("samples")->Arg(10000)->Arg(100000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_SampledMultiwayEquity(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t samples = 10000;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i % deals.size()];
+        // The first player is known, the others are random hands.
+        std::vector<CardSet> hole_cards(state.range(0));
+        hole_cards[0] = CardSet(deal.player1_cards);
+        benchmark::DoNotOptimize(EquityCalculator::sample_multiway_equity(hole_cards, CardSet(), samples, i++));
+    }
+    state.SetItemsProcessed(state.iterations() * samples);
+}
+BENCHMARK(BM_SampledMultiwayEquity)->ArgName("players")->Arg(3)->Arg(6)->Arg(10)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_HandPotential(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t community_card_count = state.range(0);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        std::vector<const Card*> community_cards(deal.community_cards.begin(),
+                                                 deal.community_cards.begin() + community_card_count);
+        benchmark::DoNotOptimize(EquityCalculator::hand_potential(deal.player1_cards, community_cards));
+    }
+}
+BENCHMARK(BM_HandPotential)->ArgName("community_cards")->Arg(3)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_RangeEquity(benchmark::State& state) {
+    const std::vector<Deal>& deals = random_deals();
+    const std::size_t community_card_count = state.range(0);
+    const HandRange range("QQ+, AKs, ATs+");
+    const HandRange opponent_range("22+, A2s+");
+    std::size_t i = 0;
+    for (auto _ : state) {
+        const Deal& deal = deals[i++ % deals.size()];
+        CardSet community_cards(std::vector<const Card*>(deal.community_cards.begin(),
+                                                         deal.community_cards.begin() + community_card_count));
+        benchmark::DoNotOptimize(EquityCalculator::range_equity(range, opponent_range, community_cards));
+    }
+}
+BENCHMARK(BM_RangeEquity)->ArgName("community_cards")->Arg(0)->Arg(3)->Arg(4)->Arg(5)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Both players call down every street to a showdown, then a new hand is dealt.
+static void BM_PokerEngineFullHand(benchmark::State& state) {
+    PokerGame game;
+    PokerEngine engine(game);
+
+    for (auto _ : state) {
+        while (!game.has_ended()) {
+            engine.make_move(game.get_player_turn(), Call{});
+        }
+
+        if (game.get_human_player().chips == 0 || game.get_computer_player().chips == 0) {
+            game.reset_game();
+            engine.reset();
+        } else {
+            engine.new_game();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PokerEngineFullHand);
+
+// One table per thread of the simulator's own pool, the same number of hands per
+// table. Easy players share no state between the tables, so hands/s grows with
+// the thread count. Medium and Hard players run their equity loops inline on
+// their table's thread but share the equity cache, and its lock.
+static void BM_MultiTableSimulation(benchmark::State& state) {
+    const Difficulty difficulty = static_cast<Difficulty>(state.range(0));
+    const std::uint64_t hands_per_table = difficulty == Difficulty::Easy ? 1000
+                                        : difficulty == Difficulty::Medium ? 100 : 10;
+    const std::size_t table_count = state.range(1);
+    MultiTableSimulator simulator(difficulty, difficulty, table_count);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(simulator.run(hands_per_table * table_count));
+    }
+    state.SetItemsProcessed(state.iterations() * hands_per_table * table_count);
+}
+
+static void multi_table_arguments(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"difficulty", "tables"});
+    for (std::size_t tables = 1; tables <= 64; tables *= 2) {
+        benchmark->Args({static_cast<int>(Difficulty::Easy), static_cast<int>(tables)});
+    }
+    for (Difficulty difficulty : {Difficulty::Medium, Difficulty::Hard}) {
+        for (std::size_t tables = 1; tables <= 16; tables *= 2) {
+            benchmark->Args({static_cast<int>(difficulty), static_cast<int>(tables)});
+        }
+    }
+}
+BENCHMARK(BM_MultiTableSimulation)->Apply(multi_table_arguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+#include "board_texture.hpp"
+
+#include "hand_range.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t MIN_COMMUNITY_CARDS = 3;
+constexpr std::size_t MAX_COMMUNITY_CARDS = 5;
+
+// Holdings counted in total and per card they use.
+struct CardCounts {
+    std::size_t total = 0;
+    std::array<std::size_t, DECK_SIZE> cards{};
+
+    void add(std::size_t card1, std::size_t card2) {
+        total++;
+        cards[card1]++;
+        cards[card2]++;
+    }
+
+    // Count of the holdings sharing no card with the given two.
+    std::size_t without(std::size_t card1, std::size_t card2) const {
+        return total - cards[card1] - cards[card2];
+    }
+};
+
+} // namespace
+
+BoardTexture BoardTextureAnalyzer::analyze(CardSet community_cards, ThreadPool& pool) {
+    const std::size_t community_card_count = community_cards.count();
+    if (community_card_count < MIN_COMMUNITY_CARDS || community_card_count > MAX_COMMUNITY_CARDS) {
+        throw std::runtime_error("Board texture requires a flop, turn or river.");
+    }
+
+    // Structure-of-arrays batch of every holding, the board repeated in each entry.
+    std::vector<std::size_t> combos;
+    std::array<std::vector<std::uint8_t>, 2> hole_cards;
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        CardSet cards = HandRange::combo_cards(combo);
+        if (!cards.intersects(community_cards)) {
+            combos.push_back(combo);
+            hole_cards[0].push_back(static_cast<std::uint8_t>(cards.first_index()));
+            hole_cards[1].push_back(static_cast<std::uint8_t>((cards - CardSet::from_index(cards.first_index())).first_index()));
+        }
+    }
+    std::array<std::vector<std::uint8_t>, MAX_COMMUNITY_CARDS> board;
+    CardSet remaining = community_cards;
+    for (std::size_t i = 0; i < community_card_count; i++) {
+        board[i].assign(combos.size(), static_cast<std::uint8_t>(remaining.first_index()));
+        remaining -= CardSet::from_index(remaining.first_index());
+    }
+
+    std::vector<PokerHandRank> ranks(combos.size());
+    pool.parallel_for(combos.size(), [&](std::size_t begin, std::size_t end) {
+        PokerHandBatch batch{};
+        batch.hole_cards = {hole_cards[0].data() + begin, hole_cards[1].data() + begin};
+        for (std::size_t i = 0; i < community_card_count; i++) {
+            batch.community_cards[i] = board[i].data() + begin;
+        }
+        batch.community_card_count = community_card_count;
+        batch.size = end - begin;
+        PokerHandRankEvaluator::evaluate_batch(batch, ranks.data() + begin);
+    });
+
+    BoardTexture texture;
+    texture.community_cards = community_cards;
+    for (std::size_t i = 0; i < combos.size(); i++) {
+        texture.holdings.push_back({combos[i], ranks[i], 0, 0});
+        texture.category_counts[PokerHandRankEvaluator::category(ranks[i])]++;
+    }
+    std::sort(texture.holdings.begin(), texture.holdings.end(), [](const RankedHolding& a, const RankedHolding& b) {
+        return a.rank > b.rank || (a.rank == b.rank && a.combo < b.combo);
+    });
+
+    // Sweep from the weakest up, counting the holdings below and equal to each
+    // rank per card, so those sharing a card are taken out.
+    auto cards_of = [](const RankedHolding& holding) {
+        CardSet cards = HandRange::combo_cards(holding.combo);
+        return std::pair{cards.first_index(), (cards - CardSet::from_index(cards.first_index())).first_index()};
+    };
+    CardCounts lower;
+    for (std::size_t group_end = texture.holdings.size(); group_end > 0;) {
+        std::size_t group_begin = group_end;
+        CardCounts equal;
+        for (; group_begin > 0 && texture.holdings[group_begin - 1].rank == texture.holdings[group_end - 1].rank; group_begin--) {
+            auto [card1, card2] = cards_of(texture.holdings[group_begin - 1]);
+            equal.add(card1, card2);
+        }
+
+        for (std::size_t i = group_begin; i < group_end; i++) {
+            auto [card1, card2] = cards_of(texture.holdings[i]);
+            texture.holdings[i].beats = lower.without(card1, card2);
+            // The holding itself was taken out once per card.
+            texture.holdings[i].ties = equal.without(card1, card2) + 1;
+        }
+        for (std::size_t i = group_begin; i < group_end; i++) {
+            auto [card1, card2] = cards_of(texture.holdings[i]);
+            lower.add(card1, card2);
+        }
+        group_end = group_begin;
+    }
+
+    for (const RankedHolding& holding : texture.holdings) {
+        if (holding.rank != texture.holdings.front().rank) {
+            break;
+        }
+        texture.nut_combos.push_back(holding.combo);
+    }
+    return texture;
+}
+
+BoardTexture BoardTextureAnalyzer::analyze(const std::vector<const Card*>& community_cards, ThreadPool& pool) {
+    CardSet cards(community_cards);
+    if (cards.count() != community_cards.size()) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
+    return analyze(cards, pool);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "card_set.hpp"
+#include "poker_hand_evaluation.hpp"
+#include "poker_hand_rank.hpp"
+#include "thread_pool.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// One of the hole card combos possible on a board.
+struct RankedHolding {
+    // Index given by HandRange::combo_index.
+    std::size_t combo;
+    PokerHandRank rank;
+    // Other holdings, not sharing a card with this one, that it beats or ties.
+    std::size_t beats;
+    std::size_t ties;
+};
+
+// Every holding possible on a board, ranked.
+struct BoardTexture {
+    CardSet community_cards;
+    // Holdings not using a community card, from the strongest down.
+    std::vector<RankedHolding> holdings;
+    // Number of holdings per category.
+    std::array<std::size_t, RoyalFlush + 1> category_counts{};
+    // Combos of the strongest holdings, several when they tie.
+    std::vector<std::size_t> nut_combos;
+};
+
+class BoardTextureAnalyzer {
+public:
+    // Rank all the holdings on a flop, turn or river at once with
+    // PokerHandRankEvaluator::evaluate_batch, in chunks spread over the thread pool.
+    static BoardTexture analyze(CardSet community_cards, ThreadPool& pool = ThreadPool::shared());
+    static BoardTexture analyze(const std::vector<const Card*>& community_cards, ThreadPool& pool = ThreadPool::shared());
+};
@@ -27,36 +27,6 @@ std::string load_card_image(const Suit suit, const Rank rank) {
 
 } // namespace
 
-std::map<std::pair<Suit, Rank>, std::shared_ptr<const Card>> Card::card_cache;
-
-Card::Card(Suit suit, Rank rank)
-    : suit(suit)
-    , rank(rank) {
-    image_path = load_card_image(suit, rank);
-}
-
-// Singleton function to get or create a card
-std::shared_ptr<const Card> Card::get_card(Suit suit, Rank rank) {
-    auto key = std::make_pair(suit, rank);
-    auto it = card_cache.find(key);
-    if (it == card_cache.end()) {
-        card_cache[key] = std::shared_ptr<const Card>(new Card(suit, rank));
-    }
-    return card_cache[key];
-}
-
-Suit Card::get_suit() const {
-    return suit;
-}
-
-Rank Card::get_rank() const {
-    return rank;
-}
-
-int Card::get_value() const {
-    return (int)rank;
-}
-
-const std::string& Card::get_card_image_path() const {
-    return image_path;
+std::string Card::get_card_image_path() const {
+    return load_card_image(suit, rank);
 }
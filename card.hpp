@@ -1,9 +1,9 @@
 #pragma once
 
 #include <array>
-#include <map>
-#include <memory>
+#include <cstddef>
 #include <string>
+#include <utility>
 
 enum class Suit {
     Hearts, Diamonds, Clubs, Spades
@@ -20,19 +20,29 @@ constexpr std::array<Rank, 13> ranks = {
     Rank::Seven, Rank::Eight, Rank::Nine, Rank::Ten, Rank::Jack, Rank::Queen, Rank::King
 };
 
+constexpr std::size_t DECK_SIZE = suits.size() * ranks.size();
+
 class Card {
 public:
-    // Singleton get or create card
-    static std::shared_ptr<const Card> get_card(Suit suit, Rank rank);
+    // The single instance of a card, from a table built at compile time: a lookup
+    // is an index, and the pointer stays valid for the whole program.
+    static constexpr const Card* get_card(Suit suit, Rank rank);
+    static constexpr const Card* get_card(std::size_t index);
 
-    Suit get_suit() const;
-    Rank get_rank() const;
-    int get_value() const;
-    const std::string& get_card_image_path() const;
+    constexpr Suit get_suit() const { return suit; }
+    constexpr Rank get_rank() const { return rank; }
+    constexpr int get_value() const { return static_cast<int>(rank); }
+    // Position of the card in a deck ordered by suit, then rank from Two to Ace (0-51).
+    constexpr std::size_t get_index() const {
+        return static_cast<std::size_t>(suit) * ranks.size() + (static_cast<std::size_t>(rank) - 2);
+    }
+    std::string get_card_image_path() const;
 
 private:
     // Private constructor to ensure singleton
-    Card(Suit suit, Rank rank);
+    constexpr Card(Suit suit, Rank rank)
+        : suit(suit)
+        , rank(rank) {}
 
     // Prevent copying and moving to ensure singleton
     Card(const Card&) = delete;
@@ -40,9 +50,27 @@ private:
     Card(Card&&) = delete;
     Card& operator=(Card&&) = delete;
 
+    template <std::size_t... Indexes>
+    static constexpr std::array<Card, DECK_SIZE> make_cards(std::index_sequence<Indexes...>);
+
     Suit suit;
     Rank rank;
-    std::string image_path;
 
-    static std::map<std::pair<Suit, Rank>, std::shared_ptr<const Card>> card_cache;
+    // Every card by index.
+    static const std::array<Card, DECK_SIZE> cards;
 };
+
+template <std::size_t... Indexes>
+constexpr std::array<Card, DECK_SIZE> Card::make_cards(std::index_sequence<Indexes...>) {
+    return {Card(suits[Indexes / ranks.size()], static_cast<Rank>(Indexes % ranks.size() + 2))...};
+}
+
+inline constexpr std::array<Card, DECK_SIZE> Card::cards = Card::make_cards(std::make_index_sequence<DECK_SIZE>());
+
+constexpr const Card* Card::get_card(Suit suit, Rank rank) {
+    return &cards[static_cast<std::size_t>(suit) * ranks.size() + (static_cast<std::size_t>(rank) - 2)];
+}
+
+constexpr const Card* Card::get_card(std::size_t index) {
+    return &cards.at(index);
+}
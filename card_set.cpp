@@ -0,0 +1,17 @@
+#include "card_set.hpp"
+
+CardSet::CardSet(std::span<const Card* const> cards)
+    : mask_(0) {
+    for (const Card* card : cards) {
+        add(card);
+    }
+}
+
+std::vector<const Card*> CardSet::to_cards() const {
+    std::vector<const Card*> cards;
+    cards.reserve(count());
+    for (std::uint64_t mask = mask_; mask != 0; mask &= mask - 1) {
+        cards.push_back(Card::get_card(std::countr_zero(mask)));
+    }
+    return cards;
+}
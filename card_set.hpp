@@ -0,0 +1,87 @@
+#pragma once
+
+#include "card.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Set of cards with one bit per card, at the position given by Card::get_index.
+// Each suit occupies 13 consecutive bits, from Two to Ace.
+class CardSet {
+public:
+    constexpr CardSet() : mask_(0) {}
+    constexpr explicit CardSet(std::uint64_t mask) : mask_(mask) {}
+    explicit CardSet(std::span<const Card* const> cards);
+
+    static constexpr CardSet from_index(std::size_t index) {
+        return CardSet(std::uint64_t{1} << index);
+    }
+
+    static CardSet from_card(const Card* card) {
+        return from_index(card->get_index());
+    }
+
+    // Every card of the deck.
+    static constexpr CardSet full_deck() {
+        return CardSet((std::uint64_t{1} << DECK_SIZE) - 1);
+    }
+
+    constexpr std::uint64_t mask() const { return mask_; }
+    constexpr std::size_t count() const { return std::popcount(mask_); }
+    constexpr bool empty() const { return mask_ == 0; }
+
+    constexpr bool contains_index(std::size_t index) const {
+        return (mask_ >> index) & 1;
+    }
+
+    bool contains(const Card* card) const {
+        return contains_index(card->get_index());
+    }
+
+    constexpr bool intersects(CardSet other) const {
+        return (mask_ & other.mask_) != 0;
+    }
+
+    // 13 bit rank mask (bit 0 is Two) of the cards of one suit.
+    constexpr unsigned suit_mask(Suit suit) const {
+        return (mask_ >> (static_cast<std::size_t>(suit) * ranks.size())) & RANK_BITS;
+    }
+
+    // 13 bit rank mask of the ranks present in any suit.
+    constexpr unsigned rank_mask() const {
+        return suit_mask(Suit::Hearts) | suit_mask(Suit::Diamonds) | suit_mask(Suit::Clubs) | suit_mask(Suit::Spades);
+    }
+
+    void add(const Card* card) {
+        mask_ |= from_card(card).mask_;
+    }
+
+    void remove(const Card* card) {
+        mask_ &= ~from_card(card).mask_;
+    }
+
+    // Index of the lowest card in the set. The set must not be empty.
+    constexpr std::size_t first_index() const {
+        return std::countr_zero(mask_);
+    }
+
+    std::vector<const Card*> to_cards() const;
+
+    constexpr CardSet operator|(CardSet other) const { return CardSet(mask_ | other.mask_); }
+    constexpr CardSet operator&(CardSet other) const { return CardSet(mask_ & other.mask_); }
+    // Cards of this set that are not in the other.
+    constexpr CardSet operator-(CardSet other) const { return CardSet(mask_ & ~other.mask_); }
+
+    constexpr CardSet& operator|=(CardSet other) { mask_ |= other.mask_; return *this; }
+    constexpr CardSet& operator&=(CardSet other) { mask_ &= other.mask_; return *this; }
+    constexpr CardSet& operator-=(CardSet other) { mask_ &= ~other.mask_; return *this; }
+
+    constexpr bool operator==(const CardSet& other) const = default;
+
+private:
+    static constexpr unsigned RANK_BITS = (1u << ranks.size()) - 1;
+
+    std::uint64_t mask_;
+};
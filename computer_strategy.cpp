@@ -1,24 +1,58 @@
 #include "computer_strategy.hpp"
+#include "equity_cache.hpp"
 #include "poker_hand_evaluator.hpp"
+#include "preflop_equity.hpp"
 
 #include <iostream>
 #include <random>
 #include <algorithm>
+#include <bit>
+#include <limits>
+#include <optional>
 #include <vector>
 
-// #include <boost/program_options.hpp>
-// #include <pokerstove/penum/ShowdownEnumerator.h>
-
-// //namespace po = boost::program_options;
-
 
 int get_random_int(std::size_t min, std::size_t max) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
+    // One generator per thread, so games on different threads don't share state.
+    thread_local std::mt19937 gen(std::random_device{}());
     std::uniform_int_distribution<> dis(min, max);
     return dis(gen);
 }
 
+namespace {
+
+// Ranks with the ace counted both low (bit 0) and high (bit 13).
+unsigned straight_rank_mask(CardSet cards) {
+    unsigned rank_mask = cards.rank_mask();
+    return (rank_mask << 1) | (rank_mask >> (ranks.size() - 1));
+}
+
+// Four cards of a suit, or four ranks in a row open at both ends, with at least
+// one hole card in the draw. Only these are worth the cost of a hand potential.
+bool has_strong_draw(CardSet hole_cards, CardSet community_cards) {
+    CardSet cards = hole_cards | community_cards;
+    for (Suit suit : suits) {
+        if (std::popcount(cards.suit_mask(suit)) == 4 && hole_cards.suit_mask(suit) != 0) {
+            return true;
+        }
+    }
+
+    unsigned rank_mask = straight_rank_mask(cards);
+    unsigned hole_rank_mask = straight_rank_mask(hole_cards);
+    unsigned runs = rank_mask & (rank_mask >> 1) & (rank_mask >> 2) & (rank_mask >> 3);
+    // A run starting from the low ace or ending on the high ace has one open end.
+    for (unsigned low = 1; low + 4 <= ranks.size(); low++) {
+        unsigned run = 0xFu << low;
+        if ((runs >> low & 1) && !(rank_mask >> (low - 1) & 1) && !(rank_mask >> (low + 4) & 1)
+            && (hole_rank_mask & run) != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
 bool ComputerStrategy::can_raise(GameState current_state){
     
     std::size_t bet = current_state.current_bet;
@@ -30,11 +64,7 @@ bool ComputerStrategy::can_raise(GameState current_state){
 }
 
 Move EasyStrategy::get_next_move(GameState current_state) {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distr(0,1);
-
-    int random_number = distr(gen);
+    int random_number = get_random_int(0, 1);
     switch (random_number){
         case 0 :
             return Call{};
@@ -146,10 +176,25 @@ int MediumStrategy::evaluate_hand_strength(const std::vector<const Card*>& hand,
         case PokerEngineEnumState::Flop:
         case PokerEngineEnumState::Turn:
         case PokerEngineEnumState::River: {
-            auto [poker_hand, poker_hand_evaluation] = PokerHandEvaluator::evaluate_hand(hand, community);
-            int score = get_hand_category_score(poker_hand_evaluation.category);
+            // Start over when the hole cards change or the board is not the one seen so far.
+            CardSet hole_cards(hand);
+            CardSet seen_cards = hand_evaluator.cards();
+            if ((seen_cards & hole_cards) != hole_cards || !(seen_cards - hole_cards - CardSet(community)).empty()) {
+                hand_evaluator = IncrementalPokerHandEvaluator(hand);
+            }
+            hand_evaluator.add_cards(community);
+
+            int score = get_hand_category_score(hand_evaluator.evaluation().category);
             int high_card = std::max((int)hand[0]->get_rank(), (int)hand[1]->get_rank());
             score += high_card / 10;
+
+            // A strong draw is played by its effective hand strength.
+            if (stage != PokerEngineEnumState::River && has_strong_draw(hole_cards, CardSet(community))) {
+                HandPotential potential = EquityCache::shared().hand_potential(hole_cards, CardSet(community));
+                if (potential.positive_potential >= DRAW_POTENTIAL_THRESHOLD) {
+                    score = std::max(score, static_cast<int>(potential.effective_hand_strength() * 100));
+                }
+            }
             return std::min(score, 100); // cap at 100
         }
 
@@ -178,235 +223,99 @@ int MediumStrategy::get_hand_category_score(PokerHandEvaluationCategory category
     return 0;
 }
 
-bool MediumStrategy::is_suited(const std::vector<const Card*>& hand) {
-    return hand[0]->get_suit() == hand[1]->get_suit();
+// Helper: Preflop strength (0 - 100), the share of starting hands with at most
+// the same heads-up equity.
+int MediumStrategy::evaluate_preflop(const std::vector<const Card*>& hand) {
+    return PreflopEquity::strength(hand[0], hand[1]);
 }
 
-// Helper: Preflop strength (0 - 100)
-int MediumStrategy::evaluate_preflop(const std::vector<const Card*>& hand) {
+HardStrategy::HardStrategy(std::chrono::microseconds decision_budget)
+    : decision_budget(decision_budget) {}
 
-    int hand1 = hand[0]->get_value();
-    int hand2 = hand[1]->get_value();
-    int high = std::max(hand1, hand2);
-    bool is_pair = hand1 == hand2;
+double HardStrategy::estimate_equity(const GameState& current_state) {
+    CardSet hole_cards(current_state.hands);
+    CardSet community_cards(current_state.community_cards);
+    EquityCache& cache = EquityCache::shared();
 
-    if(is_pair){
-        if (high >= 10){
-            return 90;
-        } else if (high >= 7) {
-            return 70;
-        }
+    if (std::optional<EquityResult> cached = cache.find(hole_cards, community_cards)) {
+        return cached->equity();
     }
+    // From the turn on the exact equity takes a few milliseconds at most.
+    if (community_cards.count() > 3) {
+        return cache.heads_up_equity(hole_cards, community_cards).equity();
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + decision_budget;
+    return EquityCalculator::sample_heads_up_equity_until(hole_cards, community_cards, deadline, TARGET_EQUITY_ERROR,
+                                                          get_random_int(0, std::numeric_limits<int>::max())).equity();
+}
 
-    bool cards_suited = is_suited(hand);
+Move HardStrategy::get_next_move(GameState current_state) {
+    std::size_t bet = current_state.current_bet;
+    std::size_t pot = current_state.pot_size;
+    std::size_t computer_chips = current_state.computer_chips;
 
-    if (cards_suited) {
-        if (std::abs(hand1 - hand2) == 1 && (hand1 >= STRONG_SUITED_THRESHOLD || hand2 >= STRONG_SUITED_THRESHOLD)) {
-            return 90;
-        } else if (hand1 >= 9 || hand2 >= 9) {
-            return 80;
-        }
+    if (current_state.community_cards.size() == 0 || computer_chips < 2 * bet) {
+        return Call{};
     }
 
-    if (high > (int)Rank::Jack) {
-        return 40;
+    double equity = estimate_equity(current_state);
+
+    std::size_t raise_amount = 0;
+    if (bet == 0) {
+        raise_amount = 20;  // Small starting bet if no bet has been placed
+    } else {
+        // Minimum raise calculation (2x the current bet)
+        raise_amount = 2 * bet;
     }
 
-    return 30;
-}
+    std::size_t proportional_raise = 0;
+    if (equity >= 0.80) {
+        proportional_raise = static_cast<std::size_t>(pot * 0.20);
+    } else if (equity >= 0.50) {
+        proportional_raise = static_cast<std::size_t>(pot * 0.15);
+    } else if (equity >= 0.30) {
+        proportional_raise = static_cast<std::size_t>(pot * 0.10);
+    }
 
-// Convert hand (vector of Card pointers) into a vector of strings in the expected format
-// std::vector<std::string> convertHandToStringFormat(const std::vector<const Card*>& hand) {
-//     std::vector<std::string> handStrings;
-
-//     for (const auto& card : hand) {
-//         if (card == nullptr) {
-//             throw std::invalid_argument("Null card detected in hand");
-//         }
-
-//         std::ostringstream cardStr;
-
-//         // Convert the Rank to string
-//         std::string rankStr;
-//         switch (card->get_rank()) {
-//             case Rank::Two:    rankStr = "2"; break;
-//             case Rank::Three:  rankStr = "3"; break;
-//             case Rank::Four:   rankStr = "4"; break;
-//             case Rank::Five:   rankStr = "5"; break;
-//             case Rank::Six:    rankStr = "6"; break;
-//             case Rank::Seven:  rankStr = "7"; break;
-//             case Rank::Eight:  rankStr = "8"; break;
-//             case Rank::Nine:   rankStr = "9"; break;
-//             case Rank::Ten:    rankStr = "T"; break;
-//             case Rank::Jack:   rankStr = "J"; break;
-//             case Rank::Queen:  rankStr = "Q"; break;
-//             case Rank::King:   rankStr = "K"; break;
-//             case Rank::Ace:    rankStr = "A"; break;
-//             default: throw std::invalid_argument("Invalid rank");
-//         }
-
-//         // Convert the Suit to string
-//         std::string suitStr;
-//         switch (card->get_suit()) {
-//             case Suit::Hearts:   suitStr = "h"; break;
-//             case Suit::Diamonds: suitStr = "d"; break;
-//             case Suit::Clubs:    suitStr = "c"; break;
-//             case Suit::Spades:   suitStr = "s"; break;
-//             default: throw std::invalid_argument("Invalid suit");
-//         }
-
-//         // Combine Rank and Suit
-//         cardStr << rankStr << suitStr;
-//         handStrings.push_back(cardStr.str());
-//     }
-
-//     return handStrings;
-// }
-
-// // HardStrategy's getNextMove function
-// Move HardStrategy::get_next_move(GameState current_state) {
-//     std::cout << "Hard Strategy !!!" << std::endl;
-    
-//     std::string game = "h";  // game type Texas Holdem Poker
-    
-//     // Convert hand and board to the expected string format
-//     std::vector<std::string> hands = convertHandToStringFormat(current_state.hands);
-//     std::vector<std::string> board_card = convertHandToStringFormat(current_state.community_cards);
-    
-//     std::size_t bet = current_state.current_bet;
-//     std::size_t pot = current_state.pot_size;
-//     std::size_t computer_chips = current_state.computer_chips;
-    
-//     if (board_card.size() == 0 || computer_chips < 2 * bet) {
-//         return Call{};
-//     }
-
-//     std::cout << "Conversion Done" << std::endl;
-
-//     // Concatenate board cards into a single string
-//     std::string board;
-//     for (size_t i = 0; i < board_card.size(); ++i) {
-//         board += board_card[i];
-//     }
-
-//     std::cout << "Board is: " << board << std::endl;
-
-//     // Allocate evaluator and create card distributions
-//     std::shared_ptr<pokerstove::PokerHandEvaluator> evaluator = pokerstove::PokerHandEvaluator::alloc(game);
-//     std::vector<pokerstove::CardDistribution> handDists;
-
-//     // Check if the hand is valid and prepare card distributions
-//     if (hands.empty()) {
-//         throw std::invalid_argument("No hands provided for evaluation");
-//     }
-
-//     for (const std::string& hand : hands) {
-//         handDists.emplace_back();
-//         handDists.back().parse(hand);
-//     }
-
-//     // Fill with random if necessary (e.g., for multi-hand evaluations)
-//     if (handDists.size() == 1) {
-//         handDists.emplace_back();
-//         handDists.back().fill(evaluator->handSize());
-//     }
-
-//     // Calculate equity results
-//     pokerstove::ShowdownEnumerator showdown;
-//     std::vector<pokerstove::EquityResult> results =
-//         showdown.calculateEquity(handDists, pokerstove::CardSet(board), evaluator);
-
-//     double total = 0.0;
-//     for (const pokerstove::EquityResult& result : results) {
-//         total += result.winShares + result.tieShares;
-//     }
-
-//     // Calculate equity for the first hand
-//     double equity = 0.0;
-//     if (!results.empty()) {
-//         equity = (results[0].winShares + results[0].tieShares) / total;
-//     }
-
-//     std::cout << "The hand " << hands[0] << " has " << equity * 100.0 << " % equity." << std::endl;
-
-//     std::size_t raise_amount = 0 ;
-    
-//     if (bet == 0) {
-//         raise_amount = 20;  // Small starting bet if no bet has been placed
-//     }else {
-        
-//         // Minimum raise calculation (2x the current bet)
-//         raise_amount = 2 * bet; 
-//     }
-     
+    // Add proportional raise to the minimum raise amount
+    raise_amount += proportional_raise;
 
-    
-//     std::size_t proportional_raise = 0;
-//     if (equity >= 0.80) {
-//         proportional_raise = static_cast<std::size_t>(pot * 0.20);
-//     } else if (equity >= 0.50) {
-//         proportional_raise = static_cast<std::size_t>(pot * 0.15);
-//     } else if (equity >= 0.30) {
-//         proportional_raise = static_cast<std::size_t>(pot * 0.10);
-//     } else {
-       
-//         proportional_raise = 0;
-//     }
-
-//     // Add proportional raise to the minimum raise amount
-//     raise_amount += proportional_raise;
-
-//     // Round the raise amount to the nearest multiple of 10
-//     raise_amount = (raise_amount / 10) * 10;
-
-//     // Ensure that the raise amount does not exceed available chips
-//     raise_amount = std::min(raise_amount, computer_chips);
-
-//     // Handle low chip count
-//     if (!can_raise(current_state)){
-            
-//             if(equity >= 0.40){
-//                 return Call{};
-            
-//             }else {
-//                 int foldChance = get_random_int(0, 100);
-//                 if (foldChance < 70) {
-//                     return Fold{};
-//                 } else {
-//                     return Call{};
-//                 }
-//             }
-//     }
-
-//     // Strong hand decision (high equity)
-//     if (equity >= 0.80) {
-//         return Raise{raise_amount};
-//     }
-//     // Moderate hand decision (medium equity)
-//     else if (equity >= 0.50) {
-//         if (computer_chips > 2 * bet) {
-//             return Raise{raise_amount};  
-//         } else {
-//             return Call{};  
-//         }
-//     }
-//     // Weak hand decision (low equity)
-//     else if (equity >= 0.30) {
-//         if (bet <= 60) {
-//             return Call{};  // If the bet is small, call
-//         } else {
-//             // Fold if bet is large and hand is weak
-//             return Fold{};
-//         }
-//     }
-//     // Very weak hand decision (low equity)
-//     else {
-//         // Very weak hand: fold or call with a small chance
-//         int foldChance = get_random_int(0, 100);
-//         if (foldChance < 70) {
-//             return Fold{};
-//         } else {
-//             return Call{};
-//         }
-//     }
-// }
+    // Round the raise amount to the nearest multiple of 10
+    raise_amount = (raise_amount / 10) * 10;
+
+    // Ensure that the raise amount does not exceed available chips
+    raise_amount = std::min(raise_amount, computer_chips);
+
+    // Handle low chip count
+    if (!can_raise(current_state)) {
+        if (equity >= 0.40) {
+            return Call{};
+        }
+        return get_random_int(0, 100) < 70 ? Move{Fold{}} : Move{Call{}};
+    }
+
+    // Strong hand decision (high equity)
+    if (equity >= 0.80) {
+        return Raise{raise_amount};
+    }
+    // Moderate hand decision (medium equity)
+    else if (equity >= 0.50) {
+        if (computer_chips > 2 * bet) {
+            return Raise{raise_amount};
+        } else {
+            return Call{};
+        }
+    }
+    // Weak hand decision (low equity)
+    else if (equity >= 0.30) {
+        if (bet <= 60) {
+            return Call{};  // If the bet is small, call
+        } else {
+            // Fold if bet is large and hand is weak
+            return Fold{};
+        }
+    }
+    // Very weak hand: fold or call with a small chance
+    return get_random_int(0, 100) < 70 ? Move{Fold{}} : Move{Call{}};
+}
@@ -5,9 +5,11 @@
 #include "game_constants.hpp"
 #include "game_state.hpp"
 
+#include <chrono>
 #include <vector>
 #include <set>
 #include "poker_hand_evaluation.hpp"
+#include "poker_hand_rank.hpp"
 
 
 
@@ -31,7 +33,6 @@ class MediumStrategy : public ComputerStrategy {
     Move get_next_move(GameState current_state) override;
 
 private:
-    bool is_suited(const std::vector<const Card*>& hand);
     int evaluate_preflop(const std::vector<const Card*>& hand);
     int evaluate_hand_strength(const std::vector<const Card*>& hand,
                          const std::vector<const Card*>& community,
@@ -49,14 +50,32 @@ private:
     const int HIGH_HAND_THRESHOLD = 80;
     const int MEDIUM_HAND_THRESHOLD = 60;
     const int WEAK_HAND_THRESHOLD = 40;
-    const int STRONG_PAIR_THRESHOLD = 10;
-    const int STRONG_SUITED_THRESHOLD = 9;                      
+    // Chance that the next card puts the hand ahead, from which it is played by
+    // its effective hand strength.
+    const double DRAW_POTENTIAL_THRESHOLD = 0.15;
+
+    // Rank of the current hand, carried over from street to street.
+    IncrementalPokerHandEvaluator hand_evaluator;
 
 
 };
 
-// class HardStrategy : public ComputerStrategy {
-//     Move get_next_move(GameState current_state) override;
-    
-// };    
+// Bets by the equity of its hand against a random hand, from the flop on. Exact
+// equities come from the shared EquityCache, and are computed on the turn and
+// river. A flop missing from the cache is sampled within the decision budget.
+class HardStrategy : public ComputerStrategy {
+public:
+    static constexpr std::chrono::microseconds DEFAULT_DECISION_BUDGET{5000};
+
+    explicit HardStrategy(std::chrono::microseconds decision_budget = DEFAULT_DECISION_BUDGET);
+
+private:
+    Move get_next_move(GameState current_state) override;
+    double estimate_equity(const GameState& current_state);
+
+    // Sampling stops earlier once the standard error is this small.
+    const double TARGET_EQUITY_ERROR = 0.0025;
+
+    std::chrono::microseconds decision_budget;
+};
 
@@ -1,31 +1,41 @@
 #include "deck.hpp"
 
-#include <algorithm>
-#include <random>
-#include <chrono>
+#include <stdexcept>
+#include <utility>
 
+Deck::Deck()
+    : Deck(Xoshiro256(Xoshiro256::random_seed())) {}
 
-Deck::Deck() {
+Deck::Deck(Xoshiro256 generator)
+    : dealt(0)
+    , generator(generator) {
     // Create a standard 52-card deck.
-    for (Suit suit : suits) {
-        for (Rank rank : ranks) {
-            cards.push_back(Card::get_card(suit, rank));
-        }
+    for (std::size_t index = 0; index < DECK_SIZE; index++) {
+        cards[index] = Card::get_card(index);
     }
 }
 
+void Deck::seed(std::uint64_t seed) {
+    generator = Xoshiro256(seed);
+    // The deals also depend on the order the cards are left in.
+    for (std::size_t index = 0; index < DECK_SIZE; index++) {
+        cards[index] = Card::get_card(index);
+    }
+    dealt = 0;
+}
+
 void Deck::shuffle() {
-    unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
-    std::shuffle(cards.begin(), cards.end(), std::default_random_engine(seed));
+    dealt = 0;
 }
 
-// suriya- comment Why shared_ptr to normal ptr 
 const Card* Deck::deal_card() {
-    std::shared_ptr<const Card> card = cards.back();
-    cards.pop_back();
-    return card.get();
+    if (is_empty()) {
+        throw std::runtime_error("No cards left in the deck.");
+    }
+    std::swap(cards[dealt], cards[dealt + generator.bounded(DECK_SIZE - dealt)]);
+    return cards[dealt++];
 }
 
 bool Deck::is_empty() const {
-    return cards.empty();
+    return dealt == DECK_SIZE;
 }
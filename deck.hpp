@@ -1,15 +1,28 @@
 #pragma once
 
 #include "card.hpp"
+#include "xoshiro256.hpp"
 
-#include <vector>
+#include <array>
+#include <cstdint>
 
 class Deck {
 public:
+    // Seeded at random.
     Deck();
+    explicit Deck(Xoshiro256 generator);
+
+    // Return every card and restart from a seed: the cards dealt from then on
+    // only depend on the seed, so they can be replayed.
+    void seed(std::uint64_t seed);
+    // Return every card to the deck. No cards are moved: each card dealt is drawn
+    // at random from those left (a partial Fisher-Yates shuffle).
     void shuffle();
     const Card* deal_card();
     bool is_empty() const;
 private:
-    std::vector<std::shared_ptr<const Card>> cards;
+    std::array<const Card*, DECK_SIZE> cards;
+    // The cards dealt are at the front of the array.
+    std::size_t dealt;
+    Xoshiro256 generator;
 };
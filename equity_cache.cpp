@@ -0,0 +1,131 @@
+#include "equity_cache.hpp"
+
+#include "hand_indexer.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Indexes of a street stay below 2^32, the board size tells the streets apart.
+constexpr int STREET_SHIFT = 32;
+// Set in the keys of hand potentials, above the board size.
+constexpr std::uint64_t POTENTIAL_KEY = std::uint64_t{1} << 40;
+
+} // namespace
+
+EquityCache::EquityCache(std::size_t capacity)
+    : capacity_(capacity)
+    , hits_(0)
+    , misses_(0) {
+    if (capacity_ == 0) {
+        throw std::runtime_error("Equity cache capacity must be positive.");
+    }
+    positions_.reserve(capacity_);
+}
+
+EquityCache& EquityCache::shared() {
+    static EquityCache cache([] {
+        const char* capacity = std::getenv(CAPACITY_VARIABLE);
+        try {
+            return capacity ? static_cast<std::size_t>(std::stoull(capacity)) : DEFAULT_CAPACITY;
+        } catch (const std::logic_error&) {
+            return DEFAULT_CAPACITY;
+        }
+    }());
+    return cache;
+}
+
+EquityResult EquityCache::heads_up_equity(CardSet hole_cards, CardSet community_cards, ThreadPool& pool) {
+    std::uint64_t situation = key(hole_cards, community_cards);
+    if (std::optional<EquityResult> result = find<EquityResult>(situation)) {
+        return *result;
+    }
+
+    EquityResult result = EquityCalculator::heads_up_equity(hole_cards, community_cards, pool);
+    insert(situation, result);
+    return result;
+}
+
+HandPotential EquityCache::hand_potential(CardSet hole_cards, CardSet community_cards, ThreadPool& pool) {
+    std::uint64_t situation = key(hole_cards, community_cards) | POTENTIAL_KEY;
+    if (std::optional<HandPotential> potential = find<HandPotential>(situation)) {
+        return *potential;
+    }
+
+    HandPotential potential = EquityCalculator::hand_potential(hole_cards, community_cards, 1, pool);
+    insert(situation, potential);
+    return potential;
+}
+
+EquityResult EquityCache::heads_up_equity(const std::vector<const Card*>& hole_cards,
+                                          const std::vector<const Card*>& community_cards,
+                                          ThreadPool& pool) {
+    return heads_up_equity(CardSet(hole_cards), CardSet(community_cards), pool);
+}
+
+std::optional<EquityResult> EquityCache::find(CardSet hole_cards, CardSet community_cards) {
+    return find<EquityResult>(key(hole_cards, community_cards));
+}
+
+std::size_t EquityCache::capacity() const {
+    return capacity_;
+}
+
+std::size_t EquityCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+std::uint64_t EquityCache::hits() const {
+    return hits_;
+}
+
+std::uint64_t EquityCache::misses() const {
+    return misses_;
+}
+
+void EquityCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    positions_.clear();
+    hits_ = 0;
+    misses_ = 0;
+}
+
+std::uint64_t EquityCache::key(CardSet hole_cards, CardSet community_cards) {
+    // The indexer checks the card counts and duplicates.
+    const HandIndexer& indexer = HandIndexer::for_board(community_cards.count());
+    return (std::uint64_t{community_cards.count()} << STREET_SHIFT) | indexer.index(hole_cards, community_cards);
+}
+
+template <typename Result>
+std::optional<Result> EquityCache::find(std::uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto position = positions_.find(key);
+    if (position == positions_.end()) {
+        misses_++;
+        return std::nullopt;
+    }
+    hits_++;
+    entries_.splice(entries_.begin(), entries_, position->second);
+    return std::get<Result>(position->second->second);
+}
+
+void EquityCache::insert(std::uint64_t key, const Value& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [position, inserted] = positions_.try_emplace(key);
+    if (!inserted) {
+        // Computed by another thread meanwhile.
+        entries_.splice(entries_.begin(), entries_, position->second);
+        return;
+    }
+
+    if (entries_.size() == capacity_) {
+        positions_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(key, value);
+    position->second = entries_.begin();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "card_set.hpp"
+#include "equity_calculator.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Bounded cache of exact heads-up equities and hand potentials, keyed by the
+// HandIndexer index of the hole cards and board, so situations differing only by their suits share an
+// entry. The least recently used entry is dropped when the cache is full. Safe to
+// use from several threads.
+class EquityCache {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 1 << 16;
+    // Environment variable overriding DEFAULT_CAPACITY for the shared cache.
+    static constexpr const char* CAPACITY_VARIABLE = "POKER_EQUITY_CACHE_SIZE";
+
+    explicit EquityCache(std::size_t capacity = DEFAULT_CAPACITY);
+
+    EquityCache(const EquityCache&) = delete;
+    EquityCache& operator=(const EquityCache&) = delete;
+
+    // Cache shared by every strategy of the process.
+    static EquityCache& shared();
+
+    // EquityCalculator::heads_up_equity, computed on a miss. Situations are
+    // computed outside the lock, so threads missing the same entry may each
+    // compute it.
+    EquityResult heads_up_equity(CardSet hole_cards, CardSet community_cards,
+                                 ThreadPool& pool = ThreadPool::shared());
+    EquityResult heads_up_equity(const std::vector<const Card*>& hole_cards,
+                                 const std::vector<const Card*>& community_cards,
+                                 ThreadPool& pool = ThreadPool::shared());
+
+    // EquityCalculator::hand_potential for the next card, computed on a miss the
+    // same way.
+    HandPotential hand_potential(CardSet hole_cards, CardSet community_cards,
+                                 ThreadPool& pool = ThreadPool::shared());
+
+    // Cached equity of a situation, without computing it on a miss.
+    std::optional<EquityResult> find(CardSet hole_cards, CardSet community_cards);
+
+    std::size_t capacity() const;
+    std::size_t size() const;
+    std::uint64_t hits() const;
+    std::uint64_t misses() const;
+
+    // Drop every entry and reset the counters.
+    void clear();
+
+private:
+    using Value = std::variant<EquityResult, HandPotential>;
+    using Entry = std::pair<std::uint64_t, Value>;
+
+    static std::uint64_t key(CardSet hole_cards, CardSet community_cards);
+    template <typename Result>
+    std::optional<Result> find(std::uint64_t key);
+    void insert(std::uint64_t key, const Value& value);
+
+    const std::size_t capacity_;
+    // Most recently used first.
+    std::list<Entry> entries_;
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> positions_;
+    mutable std::mutex mutex_;
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> misses_;
+};
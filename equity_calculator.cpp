@@ -0,0 +1,724 @@
+#include "equity_calculator.hpp"
+
+#include "poker_hand_rank.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t HOLE_CARD_COUNT = 2;
+constexpr std::size_t COMMUNITY_CARD_COUNT = 5;
+constexpr std::size_t SAMPLES_PER_BLOCK = 1024;
+// Blocks drawn between the checks of sample_heads_up_equity_until. Fixed, so the
+// samples drawn don't depend on the pool size, and a round stays around a
+// millisecond on a single thread.
+constexpr std::size_t BLOCKS_PER_ROUND = 8;
+
+void check_cards(CardSet hole_cards, CardSet community_cards) {
+    if (hole_cards.count() != HOLE_CARD_COUNT || community_cards.count() > COMMUNITY_CARD_COUNT) {
+        throw std::runtime_error("Equity requires two hole cards and at most five community cards.");
+    }
+    if (hole_cards.intersects(community_cards)) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
+}
+
+CardSet to_card_set(const std::vector<const Card*>& cards) {
+    CardSet card_set(cards);
+    if (card_set.count() != cards.size()) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
+    return card_set;
+}
+
+// Indexes of the cards left in the deck.
+std::vector<std::size_t> remaining_cards(CardSet dead_cards) {
+    std::vector<std::size_t> cards;
+    for (std::size_t index = 0; index < DECK_SIZE; index++) {
+        if (!dead_cards.contains_index(index)) {
+            cards.push_back(index);
+        }
+    }
+    return cards;
+}
+
+void add_showdown(EquityResult& result, PokerHandRank rank, PokerHandRank opponent_rank) {
+    if (rank > opponent_rank) {
+        result.wins++;
+    } else if (rank < opponent_rank) {
+        result.losses++;
+    } else {
+        result.ties++;
+    }
+}
+
+// Every set of count cards taken from cards, appended to combinations.
+void add_combinations(const std::vector<std::size_t>& cards, std::size_t count, std::size_t first,
+                      CardSet chosen, std::vector<CardSet>& combinations) {
+    if (count == 0) {
+        combinations.push_back(chosen);
+        return;
+    }
+    for (std::size_t i = first; i + count <= cards.size(); i++) {
+        add_combinations(cards, count - 1, i + 1, chosen | CardSet::from_index(cards[i]), combinations);
+    }
+}
+
+// Samples of the blocks [first_block, end_block), stopping at the given number
+// of samples in total.
+EquityResult sample_blocks(CardSet hole_cards, CardSet community_cards, const std::vector<std::size_t>& cards,
+                           std::size_t samples, std::uint64_t seed, std::size_t first_block, std::size_t end_block,
+                           ThreadPool& pool) {
+    // Opponent hole cards first, then the rest of the board.
+    const std::size_t draw_count = HOLE_CARD_COUNT + COMMUNITY_CARD_COUNT - community_cards.count();
+
+    EquityResult result;
+    std::mutex result_mutex;
+    pool.parallel_for(end_block - first_block, [&](std::size_t begin, std::size_t end) {
+        EquityResult chunk_result;
+        std::vector<std::size_t> deck;
+
+        for (std::size_t block = first_block + begin; block < first_block + end; block++) {
+            std::seed_seq seed_sequence{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                                        static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32)};
+            std::mt19937_64 gen(seed_sequence);
+            // Every block starts from the same order, so its draws only depend on its stream.
+            deck = cards;
+
+            std::size_t block_samples = std::min(SAMPLES_PER_BLOCK, samples - block * SAMPLES_PER_BLOCK);
+            for (std::size_t sample = 0; sample < block_samples; sample++) {
+                // Partial Fisher-Yates shuffle of the cards drawn. The modulo bias is
+                // negligible for 64 bit values, and unlike the standard distributions
+                // it is the same with every standard library.
+                for (std::size_t i = 0; i < draw_count; i++) {
+                    std::swap(deck[i], deck[i + gen() % (deck.size() - i)]);
+                }
+
+                CardSet board = community_cards;
+                for (std::size_t i = HOLE_CARD_COUNT; i < draw_count; i++) {
+                    board |= CardSet::from_index(deck[i]);
+                }
+                CardSet opponent_cards = CardSet::from_index(deck[0]) | CardSet::from_index(deck[1]);
+
+                add_showdown(chunk_result, PokerHandRankEvaluator::evaluate(hole_cards | board),
+                             PokerHandRankEvaluator::evaluate(opponent_cards | board));
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(result_mutex);
+        result += chunk_result;
+    });
+
+    return result;
+}
+
+// Where a hand stands against an opponent hand.
+enum Standing {
+    Ahead,
+    Tied,
+    Behind,
+    STANDING_COUNT
+};
+
+Standing standing(PokerHandRank rank, PokerHandRank opponent_rank) {
+    return rank > opponent_rank ? Ahead : rank < opponent_rank ? Behind : Tied;
+}
+
+// Opponent holdings counted by standing now and standing once the cards have come.
+using StandingCounts = std::array<std::array<std::uint64_t, STANDING_COUNT>, STANDING_COUNT>;
+
+constexpr std::size_t MAX_PLAYERS = 10;
+
+// Checks two to ten players, each with two hole cards or none when unknowns are
+// allowed, and returns every card dealt.
+CardSet check_players(const std::vector<CardSet>& hole_cards, CardSet community_cards, bool allow_unknown) {
+    if (hole_cards.size() < 2 || hole_cards.size() > MAX_PLAYERS || community_cards.count() > COMMUNITY_CARD_COUNT) {
+        throw std::runtime_error("Equity requires two to ten players and at most five community cards.");
+    }
+    CardSet dealt_cards = community_cards;
+    for (CardSet player_cards : hole_cards) {
+        if (player_cards.count() != HOLE_CARD_COUNT && !(allow_unknown && player_cards.empty())) {
+            throw std::runtime_error("Equity requires two hole cards per player.");
+        }
+        if (player_cards.intersects(dealt_cards)) {
+            throw std::runtime_error("Duplicate cards to evaluate.");
+        }
+        dealt_cards |= player_cards;
+    }
+    return dealt_cards;
+}
+
+// Adds the showdown of the players on a complete board. ranks is scratch space.
+void add_multiway_showdown(MultiwayEquityResult& result, const std::vector<CardSet>& hole_cards, CardSet board,
+                           std::vector<PokerHandRank>& ranks) {
+    PokerHandRank best_rank = 0;
+    std::uint64_t winner_count = 0;
+    for (std::size_t player = 0; player < hole_cards.size(); player++) {
+        ranks[player] = PokerHandRankEvaluator::evaluate(hole_cards[player] | board);
+        if (ranks[player] > best_rank) {
+            best_rank = ranks[player];
+            winner_count = 0;
+        }
+        winner_count += ranks[player] == best_rank;
+    }
+
+    for (std::size_t player = 0; player < hole_cards.size(); player++) {
+        if (ranks[player] == best_rank) {
+            (winner_count == 1 ? result.wins : result.ties)[player]++;
+            result.shares[player] += MultiwayEquityResult::SHARE_UNITS / winner_count;
+        }
+    }
+    result.showdowns++;
+}
+
+using SuitPermutation = std::array<std::size_t, suits.size()>;
+
+CardSet permute_suits(CardSet cards, const SuitPermutation& permutation) {
+    std::uint64_t mask = 0;
+    for (std::size_t suit = 0; suit < suits.size(); suit++) {
+        mask |= std::uint64_t{cards.suit_mask(suits[suit])} << (permutation[suit] * ranks.size());
+    }
+    return CardSet(mask);
+}
+
+std::size_t permute_combo(std::size_t combo, const SuitPermutation& permutation) {
+    CardSet cards = permute_suits(HandRange::combo_cards(combo), permutation);
+    return HandRange::combo_index(cards.first_index(), (cards - CardSet::from_index(cards.first_index())).first_index());
+}
+
+// Suit permutations (the identity included) leaving the community cards and the
+// weights of both ranges unchanged.
+std::vector<SuitPermutation> range_symmetries(const HandRange& range, const HandRange& opponent_range,
+                                              CardSet community_cards) {
+    std::vector<SuitPermutation> symmetries;
+    SuitPermutation permutation{0, 1, 2, 3};
+    do {
+        bool symmetric = permute_suits(community_cards, permutation) == community_cards;
+        for (std::size_t combo = 0; symmetric && combo < HandRange::COMBO_COUNT; combo++) {
+            std::size_t image = permute_combo(combo, permutation);
+            symmetric = range.weight(image) == range.weight(combo)
+                && opponent_range.weight(image) == opponent_range.weight(combo);
+        }
+        if (symmetric) {
+            symmetries.push_back(permutation);
+        }
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+    return symmetries;
+}
+
+struct WeightedCombo {
+    std::size_t index;
+    CardSet cards;
+    std::size_t card1;
+    std::size_t card2;
+    double weight;
+    // Weight of the same combo in the opposing range.
+    double opponent_weight;
+};
+
+std::vector<WeightedCombo> weighted_combos(const HandRange& range, const HandRange& opponent_range, CardSet dead_cards) {
+    std::vector<WeightedCombo> combos;
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        CardSet cards = HandRange::combo_cards(combo);
+        if (range.weight(combo) > 0.0 && !cards.intersects(dead_cards)) {
+            std::size_t card1 = cards.first_index();
+            std::size_t card2 = (cards - CardSet::from_index(card1)).first_index();
+            combos.push_back({combo, cards, card1, card2, range.weight(combo), opponent_range.weight(combo)});
+        }
+    }
+    return combos;
+}
+
+struct RankedCombo {
+    PokerHandRank rank;
+    const WeightedCombo* combo;
+
+    bool operator<(const RankedCombo& other) const {
+        return rank < other.rank;
+    }
+};
+
+// Weighted sums over opponent combos, in total and per card they use.
+struct CardWeights {
+    double total = 0.0;
+    std::array<double, DECK_SIZE> cards{};
+
+    void add(const WeightedCombo& combo, double weight) {
+        total += weight;
+        cards[combo.card1] += weight;
+        cards[combo.card2] += weight;
+    }
+
+    // Forget the weights of the cards of a combo, and the total.
+    void clear(const WeightedCombo& combo) {
+        total = 0.0;
+        cards[combo.card1] = 0.0;
+        cards[combo.card2] = 0.0;
+    }
+
+    // Sum over the combos sharing no card with the given one.
+    double without(const WeightedCombo& combo) const {
+        return total - cards[combo.card1] - cards[combo.card2];
+    }
+};
+
+// Adds the showdowns of every combo against every opponent combo on a complete
+// board, counted count times, to the result of the combo. Both lists are ranked
+// and swept in rank order; the opponent combos sharing a card with a combo are
+// taken out by card.
+void add_range_showdowns(CardSet board, const std::vector<WeightedCombo>& combos,
+                         const std::vector<WeightedCombo>& opponent_combos, double count,
+                         std::vector<RankedCombo>& ranked, std::vector<RankedCombo>& opponent_ranked,
+                         std::vector<RangeEquityResult>& combo_results) {
+    auto rank_combos = [board](const std::vector<WeightedCombo>& from, std::vector<RankedCombo>& to) {
+        to.clear();
+        for (const WeightedCombo& combo : from) {
+            if (!combo.cards.intersects(board)) {
+                to.push_back({PokerHandRankEvaluator::evaluate(board | combo.cards), &combo});
+            }
+        }
+        std::sort(to.begin(), to.end());
+    };
+    rank_combos(combos, ranked);
+    rank_combos(opponent_combos, opponent_ranked);
+
+    CardWeights all, lower, equal;
+    for (const RankedCombo& opponent : opponent_ranked) {
+        all.add(*opponent.combo, opponent.combo->weight);
+    }
+
+    // Opponent combos ranked below the current rank, then those ranked equal to it.
+    std::size_t lower_end = 0;
+    std::size_t equal_end = 0;
+    PokerHandRank equal_rank = 0;
+    for (const RankedCombo& hand : ranked) {
+        if (hand.rank != equal_rank) {
+            for (std::size_t i = lower_end; i < equal_end; i++) {
+                equal.clear(*opponent_ranked[i].combo);
+            }
+            for (; lower_end < opponent_ranked.size() && opponent_ranked[lower_end].rank < hand.rank; lower_end++) {
+                lower.add(*opponent_ranked[lower_end].combo, opponent_ranked[lower_end].combo->weight);
+            }
+            for (equal_end = lower_end; equal_end < opponent_ranked.size() && opponent_ranked[equal_end].rank == hand.rank; equal_end++) {
+                equal.add(*opponent_ranked[equal_end].combo, opponent_ranked[equal_end].combo->weight);
+            }
+            equal_rank = hand.rank;
+        }
+
+        // The same combo in the opposing range shares both cards and ties, so it
+        // was taken out twice from the showdowns and ties.
+        const WeightedCombo& combo = *hand.combo;
+        double showdowns = all.without(combo) + combo.opponent_weight;
+        double wins = lower.without(combo);
+        double ties = equal.without(combo) + combo.opponent_weight;
+
+        RangeEquityResult& result = combo_results[combo.index];
+        result.wins += count * wins;
+        result.ties += count * ties;
+        result.losses += count * (showdowns - wins - ties);
+    }
+}
+
+} // namespace
+
+std::uint64_t EquityResult::showdowns() const {
+    return wins + ties + losses;
+}
+
+double EquityResult::equity() const {
+    if (showdowns() == 0) {
+        return 0.0;
+    }
+    return (wins + ties / 2.0) / showdowns();
+}
+
+double EquityResult::standard_error() const {
+    if (showdowns() < 2) {
+        return 0.0;
+    }
+    // Each showdown scores 1, 1/2 or 0.
+    double mean = equity();
+    double mean_square = (wins + ties / 4.0) / showdowns();
+    double variance = std::max(mean_square - mean * mean, 0.0) * showdowns() / (showdowns() - 1);
+    return std::sqrt(variance / showdowns());
+}
+
+EquityResult& EquityResult::operator+=(const EquityResult& other) {
+    wins += other.wins;
+    ties += other.ties;
+    losses += other.losses;
+    return *this;
+}
+
+double RangeEquityResult::showdowns() const {
+    return wins + ties + losses;
+}
+
+double RangeEquityResult::equity() const {
+    if (showdowns() <= 0.0) {
+        return 0.0;
+    }
+    return (wins + ties / 2.0) / showdowns();
+}
+
+RangeEquityResult& RangeEquityResult::operator+=(const RangeEquityResult& other) {
+    wins += other.wins;
+    ties += other.ties;
+    losses += other.losses;
+    return *this;
+}
+
+MultiwayEquityResult::MultiwayEquityResult(std::size_t player_count)
+    : wins(player_count, 0)
+    , ties(player_count, 0)
+    , shares(player_count, 0) {}
+
+double MultiwayEquityResult::equity(std::size_t player) const {
+    if (showdowns == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(shares.at(player)) / SHARE_UNITS / showdowns;
+}
+
+MultiwayEquityResult& MultiwayEquityResult::operator+=(const MultiwayEquityResult& other) {
+    if (wins.size() != other.wins.size()) {
+        throw std::runtime_error("Cannot add results of different numbers of players.");
+    }
+    for (std::size_t player = 0; player < wins.size(); player++) {
+        wins[player] += other.wins[player];
+        ties[player] += other.ties[player];
+        shares[player] += other.shares[player];
+    }
+    showdowns += other.showdowns;
+    return *this;
+}
+
+double HandPotential::effective_hand_strength() const {
+    return hand_strength * (1.0 - negative_potential) + (1.0 - hand_strength) * positive_potential;
+}
+
+EquityResult EquityCalculator::heads_up_equity(CardSet hole_cards, CardSet community_cards, ThreadPool& pool) {
+    check_cards(hole_cards, community_cards);
+
+    std::vector<std::size_t> cards = remaining_cards(hole_cards | community_cards);
+    std::vector<CardSet> runouts;
+    add_combinations(cards, COMMUNITY_CARD_COUNT - community_cards.count(), 0, CardSet(), runouts);
+
+    EquityResult result;
+    std::mutex result_mutex;
+    pool.parallel_for(runouts.size(), [&](std::size_t begin, std::size_t end) {
+        EquityResult chunk_result;
+        for (std::size_t r = begin; r < end; r++) {
+            CardSet board = community_cards | runouts[r];
+            PokerHandRank rank = PokerHandRankEvaluator::evaluate(hole_cards | board);
+
+            for (std::size_t i = 0; i < cards.size(); i++) {
+                if (runouts[r].contains_index(cards[i])) {
+                    continue;
+                }
+                CardSet first_card = board | CardSet::from_index(cards[i]);
+                for (std::size_t j = i + 1; j < cards.size(); j++) {
+                    if (runouts[r].contains_index(cards[j])) {
+                        continue;
+                    }
+                    add_showdown(chunk_result, rank, PokerHandRankEvaluator::evaluate(first_card | CardSet::from_index(cards[j])));
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(result_mutex);
+        result += chunk_result;
+    });
+
+    return result;
+}
+
+EquityResult EquityCalculator::heads_up_equity(const std::vector<const Card*>& hole_cards,
+                                               const std::vector<const Card*>& community_cards,
+                                               ThreadPool& pool) {
+    return heads_up_equity(to_card_set(hole_cards), to_card_set(community_cards), pool);
+}
+
+EquityResult EquityCalculator::sample_heads_up_equity(CardSet hole_cards, CardSet community_cards,
+                                                      std::size_t samples, std::uint64_t seed, ThreadPool& pool) {
+    check_cards(hole_cards, community_cards);
+
+    const std::size_t block_count = (samples + SAMPLES_PER_BLOCK - 1) / SAMPLES_PER_BLOCK;
+    return sample_blocks(hole_cards, community_cards, remaining_cards(hole_cards | community_cards),
+                         samples, seed, 0, block_count, pool);
+}
+
+EquityResult EquityCalculator::sample_heads_up_equity(const std::vector<const Card*>& hole_cards,
+                                                      const std::vector<const Card*>& community_cards,
+                                                      std::size_t samples, std::uint64_t seed, ThreadPool& pool) {
+    return sample_heads_up_equity(to_card_set(hole_cards), to_card_set(community_cards), samples, seed, pool);
+}
+
+EquityResult EquityCalculator::sample_heads_up_equity_until(CardSet hole_cards, CardSet community_cards,
+                                                            std::chrono::steady_clock::time_point deadline,
+                                                            double target_error, std::uint64_t seed, ThreadPool& pool) {
+    check_cards(hole_cards, community_cards);
+    if (deadline == std::chrono::steady_clock::time_point::max() && target_error <= 0.0) {
+        throw std::runtime_error("Sampling requires a deadline or a target error.");
+    }
+
+    const std::vector<std::size_t> cards = remaining_cards(hole_cards | community_cards);
+
+    EquityResult result;
+    std::size_t block = 0;
+    do {
+        result += sample_blocks(hole_cards, community_cards, cards, std::numeric_limits<std::size_t>::max(),
+                                seed, block, block + BLOCKS_PER_ROUND, pool);
+        block += BLOCKS_PER_ROUND;
+    } while (std::chrono::steady_clock::now() < deadline
+             && (target_error <= 0.0 || result.standard_error() > target_error));
+
+    return result;
+}
+
+EquityResult EquityCalculator::sample_heads_up_equity_until(const std::vector<const Card*>& hole_cards,
+                                                            const std::vector<const Card*>& community_cards,
+                                                            std::chrono::steady_clock::time_point deadline,
+                                                            double target_error, std::uint64_t seed, ThreadPool& pool) {
+    return sample_heads_up_equity_until(to_card_set(hole_cards), to_card_set(community_cards),
+                                        deadline, target_error, seed, pool);
+}
+
+MultiwayEquityResult EquityCalculator::multiway_equity(const std::vector<CardSet>& hole_cards, CardSet community_cards,
+                                                      ThreadPool& pool) {
+    CardSet dealt_cards = check_players(hole_cards, community_cards, false);
+
+    std::vector<CardSet> runouts;
+    add_combinations(remaining_cards(dealt_cards), COMMUNITY_CARD_COUNT - community_cards.count(), 0, CardSet(), runouts);
+
+    MultiwayEquityResult result(hole_cards.size());
+    std::mutex result_mutex;
+    pool.parallel_for(runouts.size(), [&](std::size_t begin, std::size_t end) {
+        MultiwayEquityResult chunk_result(hole_cards.size());
+        std::vector<PokerHandRank> ranks(hole_cards.size());
+        for (std::size_t r = begin; r < end; r++) {
+            add_multiway_showdown(chunk_result, hole_cards, community_cards | runouts[r], ranks);
+        }
+
+        std::lock_guard<std::mutex> lock(result_mutex);
+        result += chunk_result;
+    });
+
+    return result;
+}
+
+MultiwayEquityResult EquityCalculator::multiway_equity(const std::vector<std::vector<const Card*>>& hole_cards,
+                                                      const std::vector<const Card*>& community_cards,
+                                                      ThreadPool& pool) {
+    std::vector<CardSet> hole_card_sets;
+    for (const std::vector<const Card*>& player_cards : hole_cards) {
+        hole_card_sets.push_back(to_card_set(player_cards));
+    }
+    return multiway_equity(hole_card_sets, to_card_set(community_cards), pool);
+}
+
+MultiwayEquityResult EquityCalculator::sample_multiway_equity(const std::vector<CardSet>& hole_cards,
+                                                             CardSet community_cards, std::size_t samples,
+                                                             std::uint64_t seed, ThreadPool& pool) {
+    const std::vector<std::size_t> cards = remaining_cards(check_players(hole_cards, community_cards, true));
+    const std::size_t unknown_count = std::count(hole_cards.begin(), hole_cards.end(), CardSet());
+    // Unknown hole cards first, then the rest of the board.
+    const std::size_t draw_count = unknown_count * HOLE_CARD_COUNT + COMMUNITY_CARD_COUNT - community_cards.count();
+    const std::size_t block_count = (samples + SAMPLES_PER_BLOCK - 1) / SAMPLES_PER_BLOCK;
+
+    MultiwayEquityResult result(hole_cards.size());
+    std::mutex result_mutex;
+    pool.parallel_for(block_count, [&](std::size_t begin, std::size_t end) {
+        MultiwayEquityResult chunk_result(hole_cards.size());
+        std::vector<PokerHandRank> ranks(hole_cards.size());
+        std::vector<CardSet> dealt_hole_cards = hole_cards;
+        std::vector<std::size_t> deck;
+
+        for (std::size_t block = begin; block < end; block++) {
+            std::seed_seq seed_sequence{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                                        static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32)};
+            std::mt19937_64 gen(seed_sequence);
+            deck = cards;
+
+            std::size_t block_samples = std::min(SAMPLES_PER_BLOCK, samples - block * SAMPLES_PER_BLOCK);
+            for (std::size_t sample = 0; sample < block_samples; sample++) {
+                for (std::size_t i = 0; i < draw_count; i++) {
+                    std::swap(deck[i], deck[i + gen() % (deck.size() - i)]);
+                }
+
+                std::size_t next = 0;
+                for (std::size_t player = 0; player < hole_cards.size(); player++) {
+                    if (hole_cards[player].empty()) {
+                        dealt_hole_cards[player] = CardSet::from_index(deck[next]) | CardSet::from_index(deck[next + 1]);
+                        next += HOLE_CARD_COUNT;
+                    }
+                }
+                CardSet board = community_cards;
+                for (; next < draw_count; next++) {
+                    board |= CardSet::from_index(deck[next]);
+                }
+
+                add_multiway_showdown(chunk_result, dealt_hole_cards, board, ranks);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(result_mutex);
+        result += chunk_result;
+    });
+
+    return result;
+}
+
+HandPotential EquityCalculator::hand_potential(CardSet hole_cards, CardSet community_cards, std::size_t cards_to_come,
+                                              ThreadPool& pool) {
+    check_cards(hole_cards, community_cards);
+    if (community_cards.count() < 3 || cards_to_come == 0
+        || community_cards.count() + cards_to_come > COMMUNITY_CARD_COUNT) {
+        throw std::runtime_error("Hand potential requires a flop or turn and the cards to come.");
+    }
+
+    std::vector<std::size_t> cards = remaining_cards(hole_cards | community_cards);
+    const PokerHandRank rank = PokerHandRankEvaluator::evaluate(hole_cards | community_cards);
+
+    // Every opponent holding and where the hole cards stand against it now.
+    struct Holding {
+        CardSet cards;
+        Standing now;
+    };
+    std::vector<Holding> holdings;
+    std::array<std::uint64_t, STANDING_COUNT> now_counts{};
+    for (std::size_t i = 0; i < cards.size(); i++) {
+        for (std::size_t j = i + 1; j < cards.size(); j++) {
+            CardSet opponent_cards = CardSet::from_index(cards[i]) | CardSet::from_index(cards[j]);
+            Standing now = standing(rank, PokerHandRankEvaluator::evaluate(opponent_cards | community_cards));
+            holdings.push_back({opponent_cards, now});
+            now_counts[now]++;
+        }
+    }
+
+    std::vector<CardSet> runouts;
+    add_combinations(cards, cards_to_come, 0, CardSet(), runouts);
+
+    StandingCounts counts{};
+    std::mutex counts_mutex;
+    pool.parallel_for(runouts.size(), [&](std::size_t begin, std::size_t end) {
+        StandingCounts chunk_counts{};
+        for (std::size_t r = begin; r < end; r++) {
+            CardSet board = community_cards | runouts[r];
+            PokerHandRank final_rank = PokerHandRankEvaluator::evaluate(hole_cards | board);
+            for (const Holding& holding : holdings) {
+                if (!holding.cards.intersects(runouts[r])) {
+                    chunk_counts[holding.now][standing(final_rank, PokerHandRankEvaluator::evaluate(holding.cards | board))]++;
+                }
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(counts_mutex);
+        for (std::size_t now = 0; now < STANDING_COUNT; now++) {
+            for (std::size_t later = 0; later < STANDING_COUNT; later++) {
+                counts[now][later] += chunk_counts[now][later];
+            }
+        }
+    });
+
+    auto total = [&counts](Standing now) {
+        return static_cast<double>(counts[now][Ahead] + counts[now][Tied] + counts[now][Behind]);
+    };
+
+    HandPotential potential;
+    potential.hand_strength = (now_counts[Ahead] + now_counts[Tied] / 2.0) / holdings.size();
+    if (double behind = total(Behind) + total(Tied) / 2.0; behind > 0.0) {
+        potential.positive_potential =
+            (counts[Behind][Ahead] + counts[Behind][Tied] / 2.0 + counts[Tied][Ahead] / 2.0) / behind;
+    }
+    if (double ahead = total(Ahead) + total(Tied) / 2.0; ahead > 0.0) {
+        potential.negative_potential =
+            (counts[Ahead][Behind] + counts[Ahead][Tied] / 2.0 + counts[Tied][Behind] / 2.0) / ahead;
+    }
+    return potential;
+}
+
+HandPotential EquityCalculator::hand_potential(const std::vector<const Card*>& hole_cards,
+                                              const std::vector<const Card*>& community_cards,
+                                              std::size_t cards_to_come, ThreadPool& pool) {
+    return hand_potential(to_card_set(hole_cards), to_card_set(community_cards), cards_to_come, pool);
+}
+
+std::vector<RangeEquityResult> EquityCalculator::combo_equity(const HandRange& range, const HandRange& opponent_range,
+                                                              CardSet community_cards, ThreadPool& pool) {
+    if (community_cards.count() > COMMUNITY_CARD_COUNT) {
+        throw std::runtime_error("Equity requires at most five community cards.");
+    }
+
+    const std::vector<SuitPermutation> symmetries = range_symmetries(range, opponent_range, community_cards);
+    const std::vector<WeightedCombo> combos = weighted_combos(range, opponent_range, community_cards);
+    const std::vector<WeightedCombo> opponent_combos = weighted_combos(opponent_range, range, community_cards);
+
+    std::vector<CardSet> runouts;
+    add_combinations(remaining_cards(community_cards), COMMUNITY_CARD_COUNT - community_cards.count(), 0, CardSet(), runouts);
+
+    std::vector<RangeEquityResult> results(HandRange::COMBO_COUNT);
+    std::mutex results_mutex;
+    pool.parallel_for(runouts.size(), [&](std::size_t begin, std::size_t end) {
+        std::vector<RangeEquityResult> chunk_results(HandRange::COMBO_COUNT);
+        std::vector<RankedCombo> ranked;
+        std::vector<RankedCombo> opponent_ranked;
+
+        for (std::size_t r = begin; r < end; r++) {
+            // Only the smallest runout of each orbit under the symmetries is
+            // evaluated, counted once per runout of the orbit.
+            bool smallest = true;
+            std::size_t stabilizer_size = 0;
+            for (const SuitPermutation& symmetry : symmetries) {
+                CardSet image = permute_suits(runouts[r], symmetry);
+                smallest = smallest && image.mask() >= runouts[r].mask();
+                stabilizer_size += image == runouts[r];
+            }
+            if (!smallest) {
+                continue;
+            }
+
+            double orbit_size = static_cast<double>(symmetries.size() / stabilizer_size);
+            add_range_showdowns(community_cards | runouts[r], combos, opponent_combos, orbit_size,
+                                ranked, opponent_ranked, chunk_results);
+        }
+
+        std::lock_guard<std::mutex> lock(results_mutex);
+        for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+            results[combo] += chunk_results[combo];
+        }
+    });
+
+    // A combo was only paired with the smallest runouts, which are not the same
+    // for its images under the symmetries. Its true results are the average over
+    // its images, as each image meets the runouts it missed.
+    std::vector<RangeEquityResult> symmetric_results(HandRange::COMBO_COUNT);
+    for (const WeightedCombo& combo : combos) {
+        for (const SuitPermutation& symmetry : symmetries) {
+            symmetric_results[combo.index] += results[permute_combo(combo.index, symmetry)];
+        }
+        symmetric_results[combo.index].wins /= symmetries.size();
+        symmetric_results[combo.index].ties /= symmetries.size();
+        symmetric_results[combo.index].losses /= symmetries.size();
+    }
+    return symmetric_results;
+}
+
+RangeEquityResult EquityCalculator::range_equity(const HandRange& range, const HandRange& opponent_range,
+                                                 CardSet community_cards, ThreadPool& pool) {
+    std::vector<RangeEquityResult> combo_results = combo_equity(range, opponent_range, community_cards, pool);
+
+    RangeEquityResult result;
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        result.wins += range.weight(combo) * combo_results[combo].wins;
+        result.ties += range.weight(combo) * combo_results[combo].ties;
+        result.losses += range.weight(combo) * combo_results[combo].losses;
+    }
+    return result;
+}
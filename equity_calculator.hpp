@@ -0,0 +1,154 @@
+#pragma once
+
+#include "card.hpp"
+#include "card_set.hpp"
+#include "hand_range.hpp"
+#include "thread_pool.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Showdown results of one hand against every opponent hand and board considered.
+struct EquityResult {
+    std::uint64_t wins = 0;
+    std::uint64_t ties = 0;
+    std::uint64_t losses = 0;
+
+    std::uint64_t showdowns() const;
+    // Average share of the pot won, a tie counting as half the pot.
+    double equity() const;
+    // Standard error of equity() when the showdowns are random samples.
+    double standard_error() const;
+
+    EquityResult& operator+=(const EquityResult& other);
+};
+
+// Showdown results of a range against another, each pair of combos counting by
+// the product of their weights.
+struct RangeEquityResult {
+    double wins = 0.0;
+    double ties = 0.0;
+    double losses = 0.0;
+
+    double showdowns() const;
+    double equity() const;
+
+    RangeEquityResult& operator+=(const RangeEquityResult& other);
+};
+
+// Showdown results of each of several players over every board (and unknown
+// hands) considered. Pot shares are counted in units of 1 / SHARE_UNITS, which
+// every split between up to ten players divides exactly, so the counts do not
+// depend on the order they were added in.
+struct MultiwayEquityResult {
+    static constexpr std::uint64_t SHARE_UNITS = 2520;
+
+    // Per player: pots won alone, pots split, and pot shares won.
+    std::vector<std::uint64_t> wins;
+    std::vector<std::uint64_t> ties;
+    std::vector<std::uint64_t> shares;
+    std::uint64_t showdowns = 0;
+
+    MultiwayEquityResult() = default;
+    explicit MultiwayEquityResult(std::size_t player_count);
+
+    // Average share of the pot won by a player.
+    double equity(std::size_t player) const;
+
+    MultiwayEquityResult& operator+=(const MultiwayEquityResult& other);
+};
+
+// Hand potential of hole cards on a flop or turn against one random hand (Billings
+// et al.): the share of the pot won now, and how often the cards to come turn a
+// hand that is behind into one ahead (positive potential) or the reverse
+// (negative potential). Ties count as half on each side.
+struct HandPotential {
+    double hand_strength = 0.0;
+    double positive_potential = 0.0;
+    double negative_potential = 0.0;
+
+    // Chance of being ahead once the cards have come:
+    // HS * (1 - NPot) + (1 - HS) * PPot.
+    double effective_hand_strength() const;
+};
+
+class EquityCalculator {
+public:
+    // Exact equity of two hole cards against one random hand, given the community
+    // cards dealt so far: every runout of the board and every opponent holding is
+    // evaluated once. Runouts are spread over the thread pool. From the flop on this
+    // is at most about a million evaluations; before the flop it is billions.
+    static EquityResult heads_up_equity(CardSet hole_cards, CardSet community_cards,
+                                        ThreadPool& pool = ThreadPool::shared());
+    static EquityResult heads_up_equity(const std::vector<const Card*>& hole_cards,
+                                        const std::vector<const Card*>& community_cards,
+                                        ThreadPool& pool = ThreadPool::shared());
+
+    // Monte Carlo estimate of the same equity from the given number of random
+    // runouts and opponent holdings. Samples are drawn in fixed blocks, each with
+    // its own random stream derived from the seed and the block number, so a seed
+    // gives the same counts whatever the number of threads.
+    static EquityResult sample_heads_up_equity(CardSet hole_cards, CardSet community_cards,
+                                               std::size_t samples, std::uint64_t seed,
+                                               ThreadPool& pool = ThreadPool::shared());
+    static EquityResult sample_heads_up_equity(const std::vector<const Card*>& hole_cards,
+                                               const std::vector<const Card*>& community_cards,
+                                               std::size_t samples, std::uint64_t seed,
+                                               ThreadPool& pool = ThreadPool::shared());
+
+    // Monte Carlo estimate sampling until the deadline or until its standard error
+    // is at most target_error, whichever comes first. Pass time_point::max() for
+    // no deadline or 0 for no target error, but not both. The result holds the
+    // estimate, its standard error and the number of samples; samples are drawn in
+    // rounds of 8 blocks of 1024, at least one round. With no deadline the result
+    // only depends on the seed, whatever the number of threads.
+    static EquityResult sample_heads_up_equity_until(CardSet hole_cards, CardSet community_cards,
+                                                     std::chrono::steady_clock::time_point deadline,
+                                                     double target_error, std::uint64_t seed,
+                                                     ThreadPool& pool = ThreadPool::shared());
+    static EquityResult sample_heads_up_equity_until(const std::vector<const Card*>& hole_cards,
+                                                     const std::vector<const Card*>& community_cards,
+                                                     std::chrono::steady_clock::time_point deadline,
+                                                     double target_error, std::uint64_t seed,
+                                                     ThreadPool& pool = ThreadPool::shared());
+
+    // Exact equity of two to ten players with known hole cards, over every runout
+    // of the community cards, spread over the thread pool.
+    static MultiwayEquityResult multiway_equity(const std::vector<CardSet>& hole_cards, CardSet community_cards,
+                                                ThreadPool& pool = ThreadPool::shared());
+    static MultiwayEquityResult multiway_equity(const std::vector<std::vector<const Card*>>& hole_cards,
+                                                const std::vector<const Card*>& community_cards,
+                                                ThreadPool& pool = ThreadPool::shared());
+
+    // Monte Carlo estimate of the same where an empty set of hole cards stands for
+    // an unknown hand, dealt at random in each sample. Seeded by blocks as
+    // sample_heads_up_equity.
+    static MultiwayEquityResult sample_multiway_equity(const std::vector<CardSet>& hole_cards, CardSet community_cards,
+                                                       std::size_t samples, std::uint64_t seed,
+                                                       ThreadPool& pool = ThreadPool::shared());
+
+    // Exact hand potential over every opponent holding and every set of the next
+    // cards_to_come community cards (1 for the next card only, up to the river).
+    // Runouts are spread over the thread pool. The next card alone is a few
+    // tens of thousands of evaluations.
+    static HandPotential hand_potential(CardSet hole_cards, CardSet community_cards, std::size_t cards_to_come = 1,
+                                        ThreadPool& pool = ThreadPool::shared());
+    static HandPotential hand_potential(const std::vector<const Card*>& hole_cards,
+                                        const std::vector<const Card*>& community_cards,
+                                        std::size_t cards_to_come = 1, ThreadPool& pool = ThreadPool::shared());
+
+    // Exact equity of a range against another range over every runout of the
+    // community cards. Combos using a community card are left out, as are pairs
+    // of combos sharing a card. Runouts that only differ by a permutation of the
+    // suits leaving both ranges and the community cards unchanged are evaluated
+    // once, and runouts are spread over the thread pool.
+    static RangeEquityResult range_equity(const HandRange& range, const HandRange& opponent_range,
+                                          CardSet community_cards, ThreadPool& pool = ThreadPool::shared());
+
+    // The same for each combo of the range on its own, its showdowns counting by
+    // the opponent weights only. Indexed by HandRange::combo_index; combos out of
+    // the range have no showdowns.
+    static std::vector<RangeEquityResult> combo_equity(const HandRange& range, const HandRange& opponent_range,
+                                                       CardSet community_cards, ThreadPool& pool = ThreadPool::shared());
+};
@@ -0,0 +1,278 @@
+#include "hand_indexer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t RANK_COUNT = ranks.size();
+
+std::uint64_t binomial(std::uint64_t n, std::uint64_t k) {
+    if (k > n) {
+        return 0;
+    }
+    std::uint64_t result = 1;
+    for (std::uint64_t i = 0; i < k; i++) {
+        result = result * (n - i) / (i + 1);
+    }
+    return result;
+}
+
+// Largest value below limit with binomial(value, k) <= index.
+std::uint64_t largest_binomial(std::uint64_t index, std::uint64_t k, std::uint64_t limit) {
+    std::uint64_t low = k > 0 ? k - 1 : 0;
+    std::uint64_t high = limit;
+    while (high - low > 1) {
+        std::uint64_t middle = low + (high - low) / 2;
+        if (binomial(middle, k) <= index) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// Colex index of a rank set among the sets of the same size taken from the ranks
+// not already used.
+std::uint64_t rank_set_index(unsigned rank_mask, unsigned used) {
+    std::uint64_t index = 0;
+    std::uint64_t position = 1;
+    for (; rank_mask != 0; rank_mask &= rank_mask - 1, position++) {
+        int rank = std::countr_zero(rank_mask);
+        index += binomial(rank - std::popcount(used & ((1u << rank) - 1)), position);
+    }
+    return index;
+}
+
+unsigned rank_set(std::uint64_t index, std::size_t count, unsigned used) {
+    unsigned rank_mask = 0;
+    std::uint64_t limit = RANK_COUNT - std::popcount(used);
+    for (std::size_t position = count; position > 0; position--) {
+        std::uint64_t compressed = largest_binomial(index, position, limit);
+        index -= binomial(compressed, position);
+        limit = compressed;
+
+        // The compressed rank counts the ranks not used below it.
+        unsigned rank = 0;
+        for (std::uint64_t unused = 0;; rank++) {
+            if (!(used & (1u << rank)) && unused++ == compressed) {
+                break;
+            }
+        }
+        rank_mask |= 1u << rank;
+    }
+    return rank_mask;
+}
+
+} // namespace
+
+HandIndexer::HandIndexer(std::vector<std::size_t> round_sizes)
+    : round_sizes_(std::move(round_sizes))
+    , size_(0) {
+    if (round_sizes_.empty() || round_sizes_.size() > MAX_ROUNDS
+        || std::find(round_sizes_.begin(), round_sizes_.end(), 0) != round_sizes_.end()) {
+        throw std::runtime_error("A hand indexer requires one to four rounds of cards.");
+    }
+
+    Counts counts{};
+    add_configurations(0, counts, 0, round_sizes_[0]);
+
+    for (Configuration& configuration : configurations_) {
+        configuration.offset = size_;
+        configuration.size = 1;
+        for (std::size_t first = 0, last; first < suits.size(); first = last) {
+            for (last = first; last < suits.size() && configuration.counts[last] == configuration.counts[first]; last++) {}
+            configuration.size *= binomial(suit_size(configuration.counts[first]) + last - first - 1, last - first);
+        }
+        size_ += configuration.size;
+    }
+}
+
+const HandIndexer& HandIndexer::for_board(std::size_t community_card_count) {
+    static const HandIndexer preflop({2});
+    static const HandIndexer flop({2, 3});
+    static const HandIndexer turn({2, 4});
+    static const HandIndexer river({2, 5});
+
+    switch (community_card_count) {
+        case 0: return preflop;
+        case 3: return flop;
+        case 4: return turn;
+        case 5: return river;
+    }
+    throw std::runtime_error("A board holds 0, 3, 4 or 5 cards.");
+}
+
+std::size_t HandIndexer::round_count() const {
+    return round_sizes_.size();
+}
+
+std::uint64_t HandIndexer::size() const {
+    return size_;
+}
+
+std::uint64_t HandIndexer::index(std::span<const CardSet> rounds) const {
+    if (rounds.size() != round_sizes_.size()) {
+        throw std::runtime_error("Wrong number of rounds to index.");
+    }
+    CardSet seen;
+    for (std::size_t round = 0; round < rounds.size(); round++) {
+        if (rounds[round].count() != round_sizes_[round] || rounds[round].intersects(seen)) {
+            throw std::runtime_error("Wrong cards to index.");
+        }
+        seen |= rounds[round];
+    }
+
+    struct SuitIndex {
+        SuitCounts counts;
+        std::uint64_t index;
+
+        auto operator<=>(const SuitIndex&) const = default;
+    };
+
+    std::array<SuitIndex, suits.size()> suit_indexes{};
+    for (std::size_t suit = 0; suit < suits.size(); suit++) {
+        unsigned used = 0;
+        std::uint64_t radix = 1;
+        for (std::size_t round = 0; round < rounds.size(); round++) {
+            unsigned rank_mask = rounds[round].suit_mask(suits[suit]);
+            suit_indexes[suit].counts[round] = std::popcount(rank_mask);
+            suit_indexes[suit].index += radix * rank_set_index(rank_mask, used);
+            radix *= binomial(RANK_COUNT - std::popcount(used), std::popcount(rank_mask));
+            used |= rank_mask;
+        }
+    }
+    std::sort(suit_indexes.begin(), suit_indexes.end(), std::greater<>());
+
+    Counts counts;
+    for (std::size_t suit = 0; suit < suits.size(); suit++) {
+        counts[suit] = suit_indexes[suit].counts;
+    }
+    const Configuration& found = configuration(counts);
+
+    // Each group of suits with the same configuration is a multiset of suit
+    // indexes, sorted in descending order: its colex index is taken on the
+    // increasing sequence index + position, from the smallest index.
+    std::uint64_t index = 0;
+    std::uint64_t radix = 1;
+    for (std::size_t first = 0, last; first < suits.size(); first = last) {
+        for (last = first; last < suits.size() && counts[last] == counts[first]; last++) {}
+
+        std::uint64_t group_index = 0;
+        for (std::size_t position = 0; position < last - first; position++) {
+            group_index += binomial(suit_indexes[last - 1 - position].index + position, position + 1);
+        }
+        index += radix * group_index;
+        radix *= binomial(suit_size(counts[first]) + last - first - 1, last - first);
+    }
+    return found.offset + index;
+}
+
+std::uint64_t HandIndexer::index(CardSet hole_cards, CardSet community_cards) const {
+    if (round_count() == 1) {
+        if (!community_cards.empty()) {
+            throw std::runtime_error("Wrong cards to index.");
+        }
+        return index(std::span<const CardSet>(&hole_cards, 1));
+    }
+    std::array<CardSet, 2> rounds = {hole_cards, community_cards};
+    return index(rounds);
+}
+
+std::vector<CardSet> HandIndexer::unindex(std::uint64_t index) const {
+    if (index >= size_) {
+        throw std::runtime_error("Hand index out of range.");
+    }
+
+    auto found = std::upper_bound(configurations_.begin(), configurations_.end(), index,
+                                  [](std::uint64_t index, const Configuration& configuration) {
+                                      return index < configuration.offset;
+                                  }) - 1;
+    std::uint64_t remaining = index - found->offset;
+
+    std::vector<CardSet> rounds(round_sizes_.size());
+    for (std::size_t first = 0, last; first < suits.size(); first = last) {
+        for (last = first; last < suits.size() && found->counts[last] == found->counts[first]; last++) {}
+        const SuitCounts& counts = found->counts[first];
+        std::uint64_t suit_count = suit_size(counts);
+        std::uint64_t group_size = binomial(suit_count + last - first - 1, last - first);
+        std::uint64_t group_index = remaining % group_size;
+        remaining /= group_size;
+
+        for (std::size_t position = last - first; position > 0; position--) {
+            std::uint64_t value = largest_binomial(group_index, position, suit_count + position - 1);
+            group_index -= binomial(value, position);
+            std::uint64_t suit_index = value - (position - 1);
+
+            // The suits of a group are sorted from the largest index down.
+            std::size_t suit = last - position;
+            unsigned used = 0;
+            for (std::size_t round = 0; round < rounds.size(); round++) {
+                std::uint64_t round_size = binomial(RANK_COUNT - std::popcount(used), counts[round]);
+                unsigned rank_mask = rank_set(suit_index % round_size, counts[round], used);
+                suit_index /= round_size;
+                rounds[round] |= CardSet(std::uint64_t{rank_mask} << (suit * RANK_COUNT));
+                used |= rank_mask;
+            }
+        }
+    }
+    return rounds;
+}
+
+std::vector<CardSet> HandIndexer::canonicalize(std::span<const CardSet> rounds) const {
+    return unindex(index(rounds));
+}
+
+void HandIndexer::add_configurations(std::size_t round, Counts& counts, std::size_t suit, std::size_t remaining) {
+    if (suit == suits.size()) {
+        if (remaining != 0) {
+            return;
+        }
+        if (round + 1 < round_sizes_.size()) {
+            add_configurations(round + 1, counts, 0, round_sizes_[round + 1]);
+            return;
+        }
+
+        Counts sorted = counts;
+        std::sort(sorted.begin(), sorted.end(), std::greater<>());
+        auto it = std::lower_bound(configurations_.begin(), configurations_.end(), sorted,
+                                   [](const Configuration& configuration, const Counts& counts) {
+                                       return configuration.counts < counts;
+                                   });
+        if (it == configurations_.end() || it->counts != sorted) {
+            configurations_.insert(it, {sorted, 0, 0});
+        }
+        return;
+    }
+
+    std::size_t used = 0;
+    for (std::size_t previous = 0; previous < round; previous++) {
+        used += counts[suit][previous];
+    }
+    for (std::size_t count = 0; count <= std::min(remaining, RANK_COUNT - used); count++) {
+        counts[suit][round] = static_cast<std::uint8_t>(count);
+        add_configurations(round, counts, suit + 1, remaining - count);
+    }
+    counts[suit][round] = 0;
+}
+
+const HandIndexer::Configuration& HandIndexer::configuration(const Counts& counts) const {
+    auto it = std::lower_bound(configurations_.begin(), configurations_.end(), counts,
+                               [](const Configuration& configuration, const Counts& counts) {
+                                   return configuration.counts < counts;
+                               });
+    return *it;
+}
+
+std::uint64_t HandIndexer::suit_size(const SuitCounts& counts) const {
+    std::uint64_t size = 1;
+    std::size_t used = 0;
+    for (std::size_t round = 0; round < round_sizes_.size(); round++) {
+        size *= binomial(RANK_COUNT - used, counts[round]);
+        used += counts[round];
+    }
+    return size;
+}
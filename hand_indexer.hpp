@@ -0,0 +1,67 @@
+#pragma once
+
+#include "card_set.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Dense index of the cards dealt over a sequence of rounds (such as the hole cards,
+// then the board), up to a permutation of the suits. Situations that only differ by
+// their suits share an index, and every index from 0 to size() - 1 is used, so
+// per-situation tables can be plain arrays: 169 entries before the flop, 1,286,792
+// with a flop, 13,960,050 with a turn and 123,156,254 with a river.
+//
+// Each suit is described by the rank sets it holds in every round. The suits are
+// sorted by their number of cards per round (their configuration), and suits with
+// the same configuration are indexed as a multiset, so the order of the suits is
+// lost. The index is the offset of the sorted configurations followed by the
+// multiset index of each group of suits.
+class HandIndexer {
+public:
+    static constexpr std::size_t MAX_ROUNDS = 4;
+
+    // Number of cards dealt in each round, at least one round and one card in each.
+    explicit HandIndexer(std::vector<std::size_t> round_sizes);
+
+    // Shared indexer of two hole cards followed by a board of 0, 3, 4 or 5 cards.
+    static const HandIndexer& for_board(std::size_t community_card_count);
+
+    std::size_t round_count() const;
+    std::uint64_t size() const;
+
+    // Index of the cards of each round. Throws if the rounds share a card or do
+    // not hold the expected number of cards.
+    std::uint64_t index(std::span<const CardSet> rounds) const;
+    // Index of hole cards and a board, for a two round indexer (one round before the flop).
+    std::uint64_t index(CardSet hole_cards, CardSet community_cards) const;
+
+    // Cards of each round of the canonical situation of an index below size().
+    // Indexing them gives the index back.
+    std::vector<CardSet> unindex(std::uint64_t index) const;
+
+    // Canonical representative of the cards of each round.
+    std::vector<CardSet> canonicalize(std::span<const CardSet> rounds) const;
+
+private:
+    using SuitCounts = std::array<std::uint8_t, MAX_ROUNDS>;
+    using Counts = std::array<SuitCounts, suits.size()>;
+
+    // Suit configurations sorted from the most cards down, with the first index
+    // and the number of indexes of the situations having them.
+    struct Configuration {
+        Counts counts;
+        std::uint64_t offset;
+        std::uint64_t size;
+    };
+
+    void add_configurations(std::size_t round, Counts& counts, std::size_t suit, std::size_t remaining);
+    const Configuration& configuration(const Counts& counts) const;
+    // Number of different rank sets per round of one suit.
+    std::uint64_t suit_size(const SuitCounts& counts) const;
+
+    std::vector<std::size_t> round_sizes_;
+    std::vector<Configuration> configurations_;
+    std::uint64_t size_;
+};
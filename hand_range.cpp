@@ -0,0 +1,198 @@
+#include "hand_range.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::string_view RANK_CHARS = "23456789TJQKA";
+constexpr std::string_view SUIT_CHARS = "hdcs";
+
+enum class Suitedness {
+    Any,
+    Suited,
+    Offsuit
+};
+
+// Two ranks (0 for Two to 12 for Ace, the first not lower) and their suitedness.
+struct StartingHand {
+    int high;
+    int low;
+    Suitedness suitedness;
+};
+
+std::runtime_error invalid_range(const std::string& token) {
+    return std::runtime_error("Invalid hand range: " + token);
+}
+
+int parse_rank(char c, const std::string& token) {
+    std::size_t rank = RANK_CHARS.find(std::toupper(static_cast<unsigned char>(c)));
+    if (rank == std::string_view::npos) {
+        throw invalid_range(token);
+    }
+    return static_cast<int>(rank);
+}
+
+int parse_suit(char c, const std::string& token) {
+    std::size_t suit = SUIT_CHARS.find(std::tolower(static_cast<unsigned char>(c)));
+    if (suit == std::string_view::npos) {
+        throw invalid_range(token);
+    }
+    return static_cast<int>(suit);
+}
+
+// Parses "AK", "AKs" or "AKo".
+StartingHand parse_starting_hand(const std::string& text, const std::string& token) {
+    if (text.size() < 2 || text.size() > 3) {
+        throw invalid_range(token);
+    }
+
+    int first = parse_rank(text[0], token);
+    int second = parse_rank(text[1], token);
+    StartingHand hand{std::max(first, second), std::min(first, second), Suitedness::Any};
+
+    if (text.size() == 3) {
+        char suitedness = std::tolower(static_cast<unsigned char>(text[2]));
+        if (suitedness == 's') {
+            hand.suitedness = Suitedness::Suited;
+        } else if (suitedness == 'o') {
+            hand.suitedness = Suitedness::Offsuit;
+        } else {
+            throw invalid_range(token);
+        }
+    }
+    if (hand.high == hand.low && hand.suitedness != Suitedness::Any) {
+        throw invalid_range(token);
+    }
+    return hand;
+}
+
+std::string trim(const std::string& text) {
+    auto is_space = [](unsigned char c) { return std::isspace(c); };
+    auto begin = std::find_if_not(text.begin(), text.end(), is_space);
+    auto end = std::find_if_not(text.rbegin(), text.rend(), is_space).base();
+    return begin < end ? std::string(begin, end) : std::string();
+}
+
+} // namespace
+
+HandRange::HandRange()
+    : weights_{} {}
+
+HandRange::HandRange(const std::string& text)
+    : HandRange() {
+    std::stringstream stream(text);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        token = trim(token);
+        if (!token.empty()) {
+            add(token);
+        }
+    }
+}
+
+std::size_t HandRange::combo_index(std::size_t card1, std::size_t card2) {
+    if (card1 == card2 || card1 >= DECK_SIZE || card2 >= DECK_SIZE) {
+        throw std::runtime_error("A combo requires two different cards.");
+    }
+    std::size_t low = std::min(card1, card2);
+    std::size_t high = std::max(card1, card2);
+    return high * (high - 1) / 2 + low;
+}
+
+CardSet HandRange::combo_cards(std::size_t combo) {
+    // Inverse of combo_index: the largest high card with high * (high - 1) / 2 <= combo.
+    std::size_t high = 1;
+    while ((high + 1) * high / 2 <= combo) {
+        high++;
+    }
+    return CardSet::from_index(high) | CardSet::from_index(combo - high * (high - 1) / 2);
+}
+
+double HandRange::weight(std::size_t combo) const {
+    return weights_.at(combo);
+}
+
+void HandRange::set_weight(std::size_t combo, double weight) {
+    if (weight < 0.0) {
+        throw std::runtime_error("Combo weights cannot be negative.");
+    }
+    weights_.at(combo) = weight;
+}
+
+std::size_t HandRange::combo_count() const {
+    return std::count_if(weights_.begin(), weights_.end(), [](double weight) { return weight > 0.0; });
+}
+
+void HandRange::add(const std::string& token) {
+    std::string body = token;
+    double weight = 1.0;
+
+    std::size_t colon = token.find(':');
+    if (colon != std::string::npos) {
+        body = trim(token.substr(0, colon));
+        try {
+            std::size_t parsed = 0;
+            std::string weight_text = trim(token.substr(colon + 1));
+            weight = std::stod(weight_text, &parsed);
+            if (parsed != weight_text.size() || weight < 0.0) {
+                throw invalid_range(token);
+            }
+        } catch (const std::logic_error&) {
+            throw invalid_range(token);
+        }
+    }
+
+    // A single combo such as "AhKh".
+    if (body.size() == 4 && body.find_first_of("+-") == std::string::npos) {
+        std::size_t card1 = parse_suit(body[1], token) * RANK_CHARS.size() + parse_rank(body[0], token);
+        std::size_t card2 = parse_suit(body[3], token) * RANK_CHARS.size() + parse_rank(body[2], token);
+        if (card1 == card2) {
+            throw invalid_range(token);
+        }
+        weights_[combo_index(card1, card2)] = weight;
+        return;
+    }
+
+    // Starting hands from first to last, which differ in the pair rank or the kicker.
+    StartingHand first{};
+    StartingHand last{};
+    std::size_t dash = body.find('-');
+    if (dash != std::string::npos) {
+        first = parse_starting_hand(body.substr(0, dash), token);
+        last = parse_starting_hand(body.substr(dash + 1), token);
+        bool pairs = first.high == first.low && last.high == last.low;
+        if (!pairs && (first.high == first.low || last.high == last.low
+                       || first.high != last.high || first.suitedness != last.suitedness)) {
+            throw invalid_range(token);
+        }
+    } else if (!body.empty() && body.back() == '+') {
+        first = parse_starting_hand(body.substr(0, body.size() - 1), token);
+        last = first;
+        if (first.high == first.low) {
+            last.high = last.low = static_cast<int>(RANK_CHARS.size()) - 1;
+        } else {
+            last.low = first.high - 1;
+        }
+    } else {
+        first = last = parse_starting_hand(body, token);
+    }
+
+    bool pairs = first.high == first.low;
+    int from = std::min(first.low, last.low);
+    int to = std::max(first.low, last.low);
+    for (int rank = from; rank <= to; rank++) {
+        int high = pairs ? rank : first.high;
+        for (int suit1 = 0; suit1 < (int)SUIT_CHARS.size(); suit1++) {
+            for (int suit2 = 0; suit2 < (int)SUIT_CHARS.size(); suit2++) {
+                if (pairs ? suit2 <= suit1 : (first.suitedness == Suitedness::Suited && suit1 != suit2)
+                                              || (first.suitedness == Suitedness::Offsuit && suit1 == suit2)) {
+                    continue;
+                }
+                weights_[combo_index(suit1 * RANK_CHARS.size() + high, suit2 * RANK_CHARS.size() + rank)] = weight;
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "card.hpp"
+#include "card_set.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+// Weighted set of the 1326 two-card starting hands ("combos"), parsed from the
+// usual range notation: a comma separated list of
+//   AA, AKs, AKo, AK      a pair, suited, offsuit or any two cards of these ranks
+//   QQ+, ATs+             a pair and the higher pairs, or raising the kicker up to
+//                         one below the top card (ATs, AJs, AQs, AKs)
+//   22-55, A2s-A5s        every pair or kicker between the two
+//   AhKh                  a single combo
+// each optionally followed by ":weight" (default 1).
+class HandRange {
+public:
+    static constexpr std::size_t COMBO_COUNT = DECK_SIZE * (DECK_SIZE - 1) / 2;
+
+    // Empty range.
+    HandRange();
+    // Throws if the text is not a valid range.
+    explicit HandRange(const std::string& text);
+
+    // Index of the combo made of two different cards, given by Card::get_index.
+    static std::size_t combo_index(std::size_t card1, std::size_t card2);
+    static CardSet combo_cards(std::size_t combo);
+
+    double weight(std::size_t combo) const;
+    void set_weight(std::size_t combo, double weight);
+
+    // Number of combos with a weight.
+    std::size_t combo_count() const;
+
+    bool operator==(const HandRange& other) const = default;
+
+private:
+    void add(const std::string& token);
+
+    std::array<double, COMBO_COUNT> weights_;
+};
@@ -18,8 +18,6 @@
 
 
 
-std::map<const Card*, QPixmap> card_image_cache;
-
 const int EASY=0, MEDIUM=1, HARD=3;
 
 std::unordered_map<std::string, int> GAME_DIFFICULTY = {
@@ -80,7 +78,7 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->strategyComboBox, &QComboBox::currentIndexChanged, this, [this](int index)
             {
     QString selected = ui->strategyComboBox->currentText();
-    bool valid = (selected == "Easy" || selected == "Medium");  // Only enable for valid choices
+    bool valid = (selected == "Easy" || selected == "Medium" || selected == "Hard");  // Only enable for valid choices
     ui->startNewGameButton->setEnabled(valid); });
 
     // Start with landing page
@@ -173,6 +171,9 @@ void MainWindow::onNewGame()
         case(MEDIUM):
             strategy = std::make_unique<MediumStrategy>();
             break;
+        case(HARD):
+            strategy = std::make_unique<HardStrategy>();
+            break;
          
         default :
             QMessageBox::warning(this, "Strategy Not Selected",
@@ -272,7 +273,7 @@ void MainWindow::displayWinner()
     ui->placeBetButton->setDisabled(true);
 }
 
-static QPixmap &loadImage(const Card *card)
+QPixmap &MainWindow::loadImage(const Card *card)
 {
     auto it = card_image_cache.find(card);
 
@@ -360,7 +361,8 @@ void MainWindow::displayGame()
             game.get_winner().value() == PokerHandWinner::Player1) {
             std::vector<const Card*> winning_cards = game.get_player(PlayerType::Human)->hand;
             if (winning_hand.has_value()) {
-                winning_cards = winning_hand.value().get_cards();
+                const auto& hand_cards = winning_hand.value().get_cards();
+                winning_cards.assign(hand_cards.begin(), hand_cards.end());
             }
 
             for (const Card* winning_card : winning_cards) {
@@ -402,7 +404,8 @@ void MainWindow::displayGame()
             game.get_winner().value() == PokerHandWinner::Player2) {
             std::vector<const Card*> winning_cards = game.get_player(PlayerType::Computer)->hand;
             if (winning_hand.has_value()) {
-                winning_cards = winning_hand.value().get_cards();
+                const auto& hand_cards = winning_hand.value().get_cards();
+                winning_cards.assign(hand_cards.begin(), hand_cards.end());
             }
 
             for (const Card* winning_card : winning_cards) {
@@ -567,6 +570,9 @@ void MainWindow::onStrategyChanged(const QString& strategy) {
         case(MEDIUM):
             selectedStrategy = std::make_unique<MediumStrategy>();
             break;
+        case(HARD):
+            selectedStrategy = std::make_unique<HardStrategy>();
+            break;
         
         default :
             return; 
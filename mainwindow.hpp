@@ -4,6 +4,7 @@
 #include <QMainWindow>
 #include <QPushButton>
 #include <QGraphicsScene>
+#include <map>
 #include "poker_engine.hpp"
 
 
@@ -37,7 +38,10 @@ private:
     void updateChipDisplay();
     void handleEndGame();
 
-    static std::map<const Card*, QPixmap> card_image_cache;
+    QPixmap& loadImage(const Card* card);
+
+    // Scaled card images, owned by the window rather than shared between instances.
+    std::map<const Card*, QPixmap> card_image_cache;
 
     void createGlowEffect(QGraphicsPixmapItem *cardItem);
     void onStrategyChanged(const QString& strategy);
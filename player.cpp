@@ -22,7 +22,7 @@ Move HumanPlayer::get_move(GameState current_state) const {
     return latest_move;
 }
 
-ComputerPlayer::ComputerPlayer(Difficulty d) : Player(PlayerType::Computer) {
+ComputerPlayer::ComputerPlayer(Difficulty d, PlayerType seat) : Player(seat) {
     switch(d) {
     case Difficulty::Easy:
         strategy = std::make_unique<EasyStrategy>();
@@ -30,9 +30,9 @@ ComputerPlayer::ComputerPlayer(Difficulty d) : Player(PlayerType::Computer) {
     case Difficulty::Medium:
         strategy = std::make_unique<MediumStrategy>();
         break;
-    // case Difficulty::Hard:
-    //     strategy = std::make_unique<HardStrategy>();
-    //     break;
+    case Difficulty::Hard:
+        strategy = std::make_unique<HardStrategy>();
+        break;
 
     default:
         throw std::runtime_error("Unexpected Input");
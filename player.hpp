@@ -6,6 +6,7 @@
 #include "game_constants.hpp"
 #include "game_state.hpp"
 
+#include <memory>
 #include <vector>
 
 enum class PlayerType {
@@ -46,7 +47,7 @@ public:
 
 class ComputerPlayer : public Player {
 public:
-    ComputerPlayer(Difficulty d);
+    ComputerPlayer(Difficulty d, PlayerType seat = PlayerType::Computer);
     virtual ~ComputerPlayer() = default;
 
     virtual Move get_move(GameState current_state) const override;
@@ -1,9 +1,10 @@
-#include <iostream>
 #include "poker_engine.hpp"
 #include "game_state.hpp"
 
 #include "poker_engine_state.hpp"
 
+#include <algorithm>
+
 PokerEngine::PokerEngine(PokerGame& poker_game)
     : game(poker_game) {
     block = new PokerEngineStatesBlock(game);
@@ -45,35 +46,22 @@ GameAction::Result PokerEngine::make_moves() {
         if (game.has_ended()) {
         return GameAction::OK;
     }
-    GameState current_state = {};
-
     PlayerType current_turn = game.get_player_turn();
 
     if (current_turn == PlayerType::Human) {
-        GameAction::Result result = make_move(PlayerType::Human, game.get_human_player().get_move(current_state));
+        GameAction::Result result = make_move(PlayerType::Human, game.get_human_player().get_move(get_game_state(PlayerType::Human)));
         if (!result.ok || game.has_ended()) {
             return result;
         }
     }
 
     if (game.get_player_turn() == PlayerType::Computer) {
-        
-        const Player& computer_player = game.get_computer_player();
-        const Player& human_player = game.get_human_player();
-        current_state.community_cards = game.get_community_cards();
-        current_state.hands = computer_player.hand;
-        current_state.stage = state->enum_state_;
-        current_state.current_bet = std::max(computer_player.current_bet,human_player.current_bet);
-        current_state.pot_size = game.get_pot();
-        current_state.computer_chips = computer_player.chips;
-
-        Move computer_move = game.get_computer_player().get_move(current_state);
+        Move computer_move = game.get_computer_player().get_move(get_game_state(PlayerType::Computer));
         game.set_player_move(PlayerType::Computer, computer_move);
 
         GameAction::Result result = make_move(PlayerType::Computer, computer_move);
 
         if (!result.ok || game.has_ended()) {
-            std::cout<< "Game Ended!" << std::endl;
             return result;
         }
     }
@@ -81,6 +69,24 @@ GameAction::Result PokerEngine::make_moves() {
     return GameAction::OK;
 }
 
+PokerEngineEnumState PokerEngine::get_stage() const {
+    return state->enum_state_;
+}
+
+GameState PokerEngine::get_game_state(PlayerType player_type) const {
+    const Player& player = player_type == PlayerType::Human ? game.get_human_player() : game.get_computer_player();
+    const Player& other_player = player_type == PlayerType::Human ? game.get_computer_player() : game.get_human_player();
+
+    GameState current_state = {};
+    current_state.community_cards = game.get_community_cards();
+    current_state.hands = player.hand;
+    current_state.stage = state->enum_state_;
+    current_state.current_bet = std::max(player.current_bet, other_player.current_bet);
+    current_state.pot_size = game.get_pot();
+    current_state.computer_chips = player.chips;
+    return current_state;
+}
+
 void PokerEngine::reset() {
     delete block;
     block = new PokerEngineStatesBlock(game);
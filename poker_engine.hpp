@@ -1,5 +1,6 @@
 #pragma once
 
+#include "game_state.hpp"
 #include "move.hpp"
 #include "poker_engine_state.hpp"
 #include "poker_game.hpp"
@@ -16,6 +17,10 @@ public:
     GameAction::Result make_moves();
     void reset();
 
+    PokerEngineEnumState get_stage() const;
+    // What a player sees of the hand when it is their turn to move.
+    GameState get_game_state(PlayerType player_type) const;
+
     friend class PokerEngineTests;
 
 private:
@@ -3,7 +3,6 @@
 #include "game_constants.hpp"
 #include "poker_hand_evaluator.hpp"
 
-#include <iostream>
 #include <optional>
 
 
@@ -14,7 +13,18 @@ PokerGame::PokerGame()
     , human_player(new HumanPlayer())
     , computer_player(new ComputerPlayer(Difficulty::Medium))
     , player_turn(PlayerType::Human)
-    , dealer(PlayerType::Human) {}
+    , dealer(PlayerType::Human)
+    , winning_rank(0) {}
+
+PokerGame::PokerGame(Difficulty human_seat_difficulty, Difficulty computer_seat_difficulty)
+    : pot(0)
+    , small_blind(5)
+    , big_blind(10)
+    , human_player(new ComputerPlayer(human_seat_difficulty, PlayerType::Human))
+    , computer_player(new ComputerPlayer(computer_seat_difficulty))
+    , player_turn(PlayerType::Human)
+    , dealer(PlayerType::Human)
+    , winning_rank(0) {}
 
 PokerGame::~PokerGame() {
     delete human_player;
@@ -157,16 +167,29 @@ void PokerGame::shuffle_deck() {
     computer_player->clear_hand();
     community_cards.clear();
 
-    deck = Deck();
     deck.shuffle();
 }
 
+void PokerGame::seed_deck(std::uint64_t seed) {
+    deck.seed(seed);
+}
+
 void PokerGame::deal_hole_cards() {
     // Deal 2 cards to each player.
     human_player->add_card(deck.deal_card());
     computer_player->add_card(deck.deal_card());
     human_player->add_card(deck.deal_card());
     computer_player->add_card(deck.deal_card());
+
+    human_hand_evaluator = IncrementalPokerHandEvaluator(human_player->hand);
+    computer_hand_evaluator = IncrementalPokerHandEvaluator(computer_player->hand);
+}
+
+void PokerGame::deal_community_card() {
+    const Card* card = deck.deal_card();
+    community_cards.push_back(card);
+    human_hand_evaluator.add_card(card);
+    computer_hand_evaluator.add_card(card);
 }
 
 void PokerGame::deal_flop() {
@@ -175,7 +198,7 @@ void PokerGame::deal_flop() {
 
     // Deal 3 community cards.
     for (int i = 0; i < 3; i++) {
-        community_cards.push_back(deck.deal_card());
+        deal_community_card();
     }
 }
 
@@ -184,7 +207,7 @@ void PokerGame::deal_turn() {
     deck.deal_card();
 
     // Deal one community card.
-    community_cards.push_back(deck.deal_card());
+    deal_community_card();
 }
 
 void PokerGame::deal_river() {
@@ -192,7 +215,7 @@ void PokerGame::deal_river() {
     deck.deal_card();
 
     // Deal one community card.
-    community_cards.push_back(deck.deal_card());
+    deal_community_card();
 }
 
 void PokerGame::clear_player_actions() {
@@ -209,6 +232,11 @@ const bool PokerGame::has_ended() const {
 }
 
 const std::optional<PokerHand> PokerGame::get_winning_hand() const {
+    if (!winning_hand.has_value() && winning_rank != 0 && winner != PokerHandWinner::Tie) {
+        const IncrementalPokerHandEvaluator& hand_evaluator =
+            winner == PokerHandWinner::Player1 ? human_hand_evaluator : computer_hand_evaluator;
+        winning_hand = PokerHandEvaluator::make_best_hand(hand_evaluator.cards(), hand_evaluator.evaluation());
+    }
     return winning_hand;
 }
 
@@ -233,10 +261,30 @@ const Player& PokerGame::get_computer_player() const {
 }
 
 void PokerGame::determine_winner() {
-    PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(human_player->hand, computer_player->hand, community_cards);
-    winner = poker_hand_result.winner;
-    winning_hand = poker_hand_result.hand;
-    hand_evaluation = poker_hand_result.evaluation;
+    // Hands or community cards changed outside of dealing are evaluated from scratch.
+    if (human_hand_evaluator.cards() != (CardSet(human_player->hand) | CardSet(community_cards))) {
+        human_hand_evaluator = IncrementalPokerHandEvaluator(human_player->hand);
+        human_hand_evaluator.add_cards(community_cards);
+    }
+    if (computer_hand_evaluator.cards() != (CardSet(computer_player->hand) | CardSet(community_cards))) {
+        computer_hand_evaluator = IncrementalPokerHandEvaluator(computer_player->hand);
+        computer_hand_evaluator.add_cards(community_cards);
+    }
+
+    PokerHandRank human_rank = human_hand_evaluator.rank();
+    PokerHandRank computer_rank = computer_hand_evaluator.rank();
+
+    if (human_rank > computer_rank) {
+        winner = PokerHandWinner::Player1;
+        winning_rank = human_rank;
+    } else if (computer_rank > human_rank) {
+        winner = PokerHandWinner::Player2;
+        winning_rank = computer_rank;
+    } else {
+        winner = PokerHandWinner::Tie;
+        winning_rank = human_rank;
+    }
+    winning_hand = {};
 
     switch(winner.value()) {
     case PokerHandWinner::Tie:
@@ -257,8 +305,8 @@ void PokerGame::prepare_new_game() {
     human_player->current_bet = 0;
     computer_player->current_bet = 0;
     winner = {};
+    winning_rank = 0;
     winning_hand = {};
-    hand_evaluation = {};
 
     // Rotate dealer
     rotate_dealer();
@@ -301,10 +349,10 @@ void PokerGame::set_player_move(PlayerType player_type, Move move) {
 }
 
 std::string PokerGame::get_winning_hand_description() const {
-    if (!winner.has_value() || !hand_evaluation.has_value()) {
+    if (!winner.has_value() || winning_rank == 0) {
         return "Unknown hand";
     }
-    return hand_evaluation.value().to_string();
+    return PokerHandRankEvaluator::evaluation(winning_rank).to_string();
 }
 
 void PokerGame::add_observer(Observer* observer) {
@@ -312,9 +360,7 @@ void PokerGame::add_observer(Observer* observer) {
 }
 
 void PokerGame::notify_game_event(std::shared_ptr<GameEvent> event) {
-    std::cout << "[DEBUG] Notifying observers of game event " << observers.size() << " observers" << std::endl;
     for (auto* obs : observers) {
-        std::cout << "[DEBUG] Notifying observer" << std::endl;
         obs->on_game_event(*event);
     }
 }
@@ -322,7 +368,8 @@ void PokerGame::notify_game_event(std::shared_ptr<GameEvent> event) {
 void PokerGame::reset_game() {
     pot = 0;
     winner = {};
-    hand_evaluation = {};
+    winning_rank = 0;
+    winning_hand = {};
 
     human_player->reset();
     computer_player->reset();
@@ -330,6 +377,6 @@ void PokerGame::reset_game() {
     player_turn = PlayerType::Human;
     dealer = PlayerType::Human;
 
-    deck = Deck();
+    deck.shuffle();
     community_cards.clear();
 }
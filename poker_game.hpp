@@ -5,6 +5,8 @@
 #include "poker_hand_evaluator.hpp"
 #include "observer.hpp"
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -33,6 +35,8 @@ inline Result ERROR(const std::string& error_message) {
 class PokerGame {
 public:
     PokerGame();
+    // Game between two computer players, the first one taking the human player's seat.
+    PokerGame(Difficulty human_seat_difficulty, Difficulty computer_seat_difficulty);
     virtual ~PokerGame();
 
     GameAction::Result perform_call(PlayerType player_type);
@@ -52,6 +56,8 @@ public:
     void rotate_player_turn();
     void post_blinds();
     void shuffle_deck();
+    // Deal the following hands from a seed, to replay them.
+    void seed_deck(std::uint64_t seed);
     void prepare_new_game();
     void determine_winner();
 
@@ -76,6 +82,8 @@ public:
     void reset_game();
 
 private:
+    void deal_community_card();
+
     std::size_t pot;
     std::size_t small_blind;
     std::size_t big_blind;
@@ -85,12 +93,18 @@ private:
     Player* computer_player;
     std::vector<const Card*> community_cards;
 
+    // Hand ranks kept up to date as each street is dealt, for the showdown.
+    IncrementalPokerHandEvaluator human_hand_evaluator;
+    IncrementalPokerHandEvaluator computer_hand_evaluator;
+
     PlayerType dealer;
     PlayerType player_turn;
 
-    std::optional<PokerHand> winning_hand;
     std::optional<PokerHandWinner> winner;
-    std::optional<PokerHandEvaluation> hand_evaluation;
+    // Rank of the winning hand at a showdown, or 0 when the hand ended with a fold.
+    PokerHandRank winning_rank;
+    // The five winning cards, only rebuilt when first asked for.
+    mutable std::optional<PokerHand> winning_hand;
 
     std::vector<Observer*> observers;
 };
@@ -1,12 +1,8 @@
 #include "poker_hand.hpp"
 
-PokerHand::PokerHand(std::vector<const Card*>& cards)
+PokerHand::PokerHand(const std::array<const Card*, POKER_HAND_SIZE>& cards)
     : cards_(cards) {}
 
-const std::vector<const Card*>& PokerHand::get_cards() const {
+const std::array<const Card*, POKER_HAND_SIZE>& PokerHand::get_cards() const {
     return cards_;
 }
-
-const PokerHandEvaluation PokerHand::accept(const PokerHandVisitor& visitor) const {
-    return visitor.visit(this);
-}
@@ -1,19 +1,17 @@
 #pragma once
 
 #include "card.hpp"
-#include "poker_hand_visitable.hpp"
 
-#include <vector>
+#include <array>
 
 constexpr std::size_t POKER_HAND_SIZE = 5;
 
-class PokerHand : public PokerHandVisitable {
+class PokerHand {
 public:
-    PokerHand(std::vector<const Card*>& cards);
+    explicit PokerHand(const std::array<const Card*, POKER_HAND_SIZE>& cards);
 
-    const PokerHandEvaluation accept(const PokerHandVisitor& visitor) const override;
-    const std::vector<const Card*>& get_cards() const;
+    const std::array<const Card*, POKER_HAND_SIZE>& get_cards() const;
 
 private:
-    std::vector<const Card*> cards_;
+    std::array<const Card*, POKER_HAND_SIZE> cards_;
 };
@@ -1,18 +1,11 @@
 #include "poker_hand_evaluation.hpp"
 
-// Comparison operator for HandEvaluation.
-// First compare category, then each tiebreaker in order.
-bool PokerHandEvaluation::operator>(const PokerHandEvaluation &other) const {
-    if (category != other.category)
-        return category > other.category;
-    // Compare tiebreakers.
-    size_t n = std::min(tiebreakers.size(), other.tiebreakers.size());
-    for (size_t i = 0; i < n; i++) {
-        if (tiebreakers[i] != other.tiebreakers[i])
-            return tiebreakers[i] > other.tiebreakers[i];
+int PokerHandEvaluation::tiebreaker(std::size_t index) const {
+    if (index >= POKER_HAND_MAX_TIEBREAKERS) {
+        return 0;
     }
-    // They are equal.
-    return false;
+    int shift = POKER_HAND_CATEGORY_SHIFT - POKER_HAND_TIEBREAKER_BITS * (index + 1);
+    return (strength >> shift) & ((1 << POKER_HAND_TIEBREAKER_BITS) - 1);
 }
 
 std::string PokerHandEvaluation::to_string() const {
@@ -44,7 +37,7 @@ std::string PokerHandEvaluation::to_string() const {
                 break;
             case PokerHandEvaluationCategory::StraightFlush:
                 // Check if it's a royal flush by examining the tiebreakers
-                if (!tiebreakers.empty() && tiebreakers[0] == 14) { // Ace high
+                if (tiebreaker(0) == 14) { // Ace high
                     hand_type = "Royal Flush";
                 } else {
                     hand_type = "Straight Flush";
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 // Hand categories (the higher, the better).
@@ -18,16 +19,25 @@ enum PokerHandEvaluationCategory {
     RoyalFlush,
 };
 
+// Layout of PokerHandEvaluation::strength.
+constexpr int POKER_HAND_CATEGORY_SHIFT = 20;
+constexpr int POKER_HAND_TIEBREAKER_BITS = 4;
+constexpr std::size_t POKER_HAND_MAX_TIEBREAKERS = 5;
+
 struct PokerHandEvaluation {
     PokerHandEvaluationCategory category;
-    // A vector of tiebreaker values in descending order.
-    std::vector<int> tiebreakers;
+    // The category in the high bits followed by up to five tiebreaker values
+    // in descending order, four bits each, so evaluations compare as integers.
+    std::uint32_t strength;
 
     // Compare two evaluations.
-    bool operator>(const PokerHandEvaluation &other) const;
+    bool operator>(const PokerHandEvaluation &other) const {
+        return strength > other.strength;
+    }
+
+    // Tiebreaker value at the given position, or 0 if the category has fewer.
+    int tiebreaker(std::size_t index) const;
 
     // Convert the PokerHandEvaluationCategory to a string representation.
     std::string to_string() const;
 };
-
-const PokerHandEvaluation lowest_evaluation = {HighCard, {0}};
@@ -1,9 +1,12 @@
 #include "poker_hand_evaluator.hpp"
 
 #include "poker_hand.hpp"
+#include "poker_hand_rank_file.hpp"
 
 #include <algorithm>
-#include <memory>
+#include <array>
+#include <bit>
+#include <stdexcept>
 
 namespace {
 
@@ -12,95 +15,94 @@ bool compare_card_desc(const Card* a, const Card* b) {
     return a->get_value() > b->get_value();
 }
 
-// Create all possible 5 card combinations from 7 cards (2 player cards and 5 community cards)
-std::vector<PokerHand> all_five_card_combinations(const std::vector<const Card*>& player_cards,
-                                                  const std::vector<const Card*>& community_cards) {
-    std::vector<const Card*> all_cards{};
-    all_cards.insert(all_cards.begin(), player_cards.begin(), player_cards.end());
-    all_cards.insert(all_cards.begin(), community_cards.begin(), community_cards.end());
-
-    // Use indices for combination: choose 5 out of n.
-    std::vector<int> indices(all_cards.size(), 0);
-    // First 5 indices set to 1.
-    std::fill(indices.begin(), indices.begin() + POKER_HAND_SIZE, 1);
-    std::sort(indices.begin(), indices.end(), std::greater<int>());
-
-    std::vector<PokerHand> poker_hands{};
-    do {
-        std::vector<const Card*> combination;
-        for (int i = 0; i < all_cards.size(); i++) {
-            if (indices[i] == 1) {
-                combination.push_back(all_cards[i]);
-            }
+// Move count cards of the given value from candidates to chosen.
+void take_cards(CardSet& candidates, std::array<const Card*, POKER_HAND_SIZE>& chosen, std::size_t& chosen_count,
+                int value, int count) {
+    for (Suit suit : suits) {
+        std::size_t index = static_cast<std::size_t>(suit) * ranks.size() + (value - 2);
+        if (count > 0 && candidates.contains_index(index)) {
+            chosen[chosen_count++] = Card::get_card(index);
+            candidates -= CardSet::from_index(index);
+            count--;
         }
+    }
+}
 
-        // Sort cards by rank
-        std::sort(combination.begin(), combination.end(), compare_card_desc);
-
-        poker_hands.push_back(PokerHand(combination));
-    } while (std::prev_permutation(indices.begin(), indices.end()));
+// Rank from the precomputed rank file when there is one.
+PokerHandRank rank_hand(const std::vector<const Card*>& player_cards, const std::vector<const Card*>& community_cards) {
+    if (const PokerHandRankFile* rank_file = PokerHandRankFile::shared()) {
+        return rank_file->evaluate(player_cards, community_cards);
+    }
+    return PokerHandRankEvaluator::evaluate(player_cards, community_cards);
+}
 
-    return poker_hands;
+PokerHandRank rank_hand(CardSet cards) {
+    if (const PokerHandRankFile* rank_file = PokerHandRankFile::shared()) {
+        return rank_file->evaluate(cards);
+    }
+    return PokerHandRankEvaluator::evaluate(cards);
 }
 
-// Create the visitors
-std::vector<std::unique_ptr<PokerHandVisitor>> make_visitors(const std::vector<std::pair<int,int>>& card_frequencies) {
-    std::vector<std::unique_ptr<PokerHandVisitor>> visitors;
-
-    visitors.emplace_back(std::make_unique<StraightFlushVisitor>());
-    visitors.emplace_back(std::make_unique<FourOfAKindVisitor>(card_frequencies));
-    visitors.emplace_back(std::make_unique<FullHouseVisitor>(card_frequencies));
-    visitors.emplace_back(std::make_unique<FlushVisitor>());
-    visitors.emplace_back(std::make_unique<StraightVisitor>());
-    visitors.emplace_back(std::make_unique<ThreeOfAKindVisitor>(card_frequencies));
-    visitors.emplace_back(std::make_unique<TwoPairVisitor>(card_frequencies));
-    visitors.emplace_back(std::make_unique<OnePairVisitor>(card_frequencies));
-    visitors.emplace_back(std::make_unique<HighCardVisitor>());
-
-    return visitors;
+} // namespace
+
+PokerHand PokerHandEvaluator::make_best_hand(const std::vector<const Card*>& player_cards,
+                                             const std::vector<const Card*>& community_cards,
+                                             const PokerHandEvaluation& evaluation) {
+    return make_best_hand(CardSet(player_cards) | CardSet(community_cards), evaluation);
 }
 
-std::tuple<PokerHand, PokerHandEvaluation> evaluate_poker_hands(const std::vector<PokerHand>& poker_hands) {
-    PokerHand best_hand = poker_hands.at(0);
-    PokerHandEvaluation best_evaluation = lowest_evaluation;
+PokerHand PokerHandEvaluator::make_best_hand(CardSet cards, const PokerHandEvaluation& evaluation) {
+    CardSet candidates = cards;
 
-    for (const PokerHand& poker_hand : poker_hands) {
-        // Count rank frequencies.
-        std::map<int, int> freq;
-        for (const Card* c : poker_hand.get_cards()) {
-            freq[c->get_value()]++;
+    // Flushes only use the cards of the flush suit.
+    if (evaluation.category == Flush || evaluation.category == StraightFlush) {
+        for (Suit suit : suits) {
+            unsigned suit_mask = cards.suit_mask(suit);
+            if (static_cast<std::size_t>(std::popcount(suit_mask)) >= POKER_HAND_SIZE) {
+                candidates = CardSet(std::uint64_t{suit_mask} << (static_cast<std::size_t>(suit) * ranks.size()));
+                break;
+            }
         }
+    }
 
-        // Create a sorted vector of pairs (frequency, rank) for tiebreakers.
-        // We sort first by frequency descending, then by rank descending.
-        std::vector<std::pair<int,int>> freqVec;
-        for (auto &p : freq) {
-            freqVec.push_back({p.second, p.first});
+    std::array<const Card*, POKER_HAND_SIZE> chosen{};
+    std::size_t chosen_count = 0;
+    switch (evaluation.category) {
+    case Straight:
+    case StraightFlush:
+        for (std::size_t i = 0; i < POKER_HAND_SIZE; i++) {
+            int value = evaluation.tiebreaker(0) - static_cast<int>(i);
+            take_cards(candidates, chosen, chosen_count, value == 1 ? (int)Rank::Ace : value, 1);
         }
-        std::sort(freqVec.begin(), freqVec.end(), [](const std::pair<int,int>& a, const std::pair<int,int>& b) {
-            if (a.first == b.first)
-                return a.second > b.second;
-            return a.first > b.first;
-        });
-
-        std::vector<std::unique_ptr<PokerHandVisitor>> visitors = make_visitors(freqVec);
-
-        // Begin hand evaluation using visitors
-        PokerHandEvaluation visitor_evaluation = lowest_evaluation;
-        for (std::unique_ptr<PokerHandVisitor>& visitor : visitors) {
-            PokerHandEvaluation visitor_evaluation = poker_hand.accept(*visitor);
-            if (visitor_evaluation > best_evaluation) {
-                best_hand = poker_hand;
-                best_evaluation = visitor_evaluation;
-                break;
-            }
+        break;
+    default: {
+        // Number of cards sharing each tiebreaker value.
+        std::array<int, POKER_HAND_MAX_TIEBREAKERS> counts{};
+        switch (evaluation.category) {
+        case FourOfAKind:  counts = {4, 1}; break;
+        case FullHouse:    counts = {3, 2}; break;
+        case ThreeOfAKind: counts = {3, 1, 1}; break;
+        case TwoPair:      counts = {2, 2, 1}; break;
+        case OnePair:      counts = {2, 1, 1, 1}; break;
+        default:           counts = {1, 1, 1, 1, 1}; break;
+        }
+
+        for (std::size_t i = 0; i < counts.size() && counts[i] > 0; i++) {
+            take_cards(candidates, chosen, chosen_count, evaluation.tiebreaker(i), counts[i]);
         }
+        break;
+    }
     }
 
-    return std::tuple(best_hand, best_evaluation);
-}
+    if (chosen_count != POKER_HAND_SIZE) {
+        throw std::runtime_error("Evaluation does not match the cards.");
+    }
 
-} // namespace
+    // Sort cards by rank
+    std::sort(chosen.begin(), chosen.end(), compare_card_desc);
+
+    return PokerHand(chosen);
+}
 
 std::tuple<PokerHand, PokerHandEvaluation> PokerHandEvaluator::evaluate_hand(const std::vector<const Card*>& player_cards,
                                                       const std::vector<const Card*>& community_cards) {
@@ -109,12 +111,14 @@ std::tuple<PokerHand, PokerHandEvaluation> PokerHandEvaluator::evaluate_hand(con
     if (player_cards.size() != 2 || community_cards.size() < 3) {
         throw std::runtime_error("Not enough cards to evaluate.");
     }
+    if ((CardSet(player_cards) | CardSet(community_cards)).count() != player_cards.size() + community_cards.size()) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
 
-    std::vector<PokerHand> player_poker_hands = all_five_card_combinations(player_cards, community_cards);
-
-    auto [player_best_hand, player_best_evaluation] = evaluate_poker_hands(player_poker_hands);
+    PokerHandRank rank = rank_hand(player_cards, community_cards);
+    PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(rank);
 
-    return std::tuple(player_best_hand, player_best_evaluation);
+    return std::tuple(make_best_hand(player_cards, community_cards, evaluation), evaluation);
 }
 
 PokerHandResult PokerHandEvaluator::determine_winner(const std::vector<const Card*>& player1_cards,
@@ -125,15 +129,114 @@ PokerHandResult PokerHandEvaluator::determine_winner(const std::vector<const Car
     if (player1_cards.size() != 2 || player2_cards.size() != 2 || community_cards.size() != 5) {
         throw std::runtime_error("Not enough cards to evaluate.");
     }
+    if ((CardSet(player1_cards) | CardSet(player2_cards) | CardSet(community_cards)).count()
+        != player1_cards.size() + player2_cards.size() + community_cards.size()) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
+
+    PokerHandRank player1_rank = rank_hand(player1_cards, community_cards);
+    PokerHandRank player2_rank = rank_hand(player2_cards, community_cards);
+
+    if (player1_rank > player2_rank) {
+        PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(player1_rank);
+        return {make_best_hand(player1_cards, community_cards, evaluation), PokerHandWinner::Player1, evaluation};
+    } else if (player2_rank > player1_rank) {
+        PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(player2_rank);
+        return {make_best_hand(player2_cards, community_cards, evaluation), PokerHandWinner::Player2, evaluation};
+    } else {
+        return {std::nullopt, PokerHandWinner::Tie, PokerHandRankEvaluator::evaluation(player1_rank)};
+    }
+}
+
+PokerShowdownResult PokerHandEvaluator::determine_winners(const std::vector<std::vector<const Card*>>& players_cards,
+                                                         const std::vector<const Card*>& community_cards) {
+    std::vector<CardSet> player_sets;
+    for (const std::vector<const Card*>& player_cards : players_cards) {
+        if (player_cards.size() != 2) {
+            throw std::runtime_error("Not enough cards to evaluate.");
+        }
+        player_sets.push_back(CardSet(player_cards));
+    }
+    if (community_cards.size() != 5) {
+        throw std::runtime_error("Not enough cards to evaluate.");
+    }
+    return determine_winners(player_sets, CardSet(community_cards));
+}
+
+PokerShowdownResult PokerHandEvaluator::determine_winners(const std::vector<CardSet>& players_cards, CardSet community_cards) {
+
+    // Ensure we have enough cards (this assumes all 5 community cards are dealt)
+    if (players_cards.size() < 2 || community_cards.count() != 5) {
+        throw std::runtime_error("Not enough cards to evaluate.");
+    }
+
+    CardSet dealt_cards = community_cards;
+    for (CardSet player_cards : players_cards) {
+        if (player_cards.count() != 2) {
+            throw std::runtime_error("Not enough cards to evaluate.");
+        }
+        if (player_cards.intersects(dealt_cards)) {
+            throw std::runtime_error("Duplicate cards to evaluate.");
+        }
+        dealt_cards |= player_cards;
+    }
+
+    PokerShowdownResult result;
+    PokerHandRank best_rank = 0;
+    for (std::size_t player = 0; player < players_cards.size(); player++) {
+        PokerHandRank rank = rank_hand(players_cards[player] | community_cards);
+        if (rank > best_rank) {
+            best_rank = rank;
+            result.winners.clear();
+        }
+        if (rank == best_rank) {
+            result.winners.push_back(player);
+        }
+    }
+    result.evaluation = PokerHandRankEvaluator::evaluation(best_rank);
+    return result;
+}
+
+void PokerHandEvaluator::evaluate_batch(const PokerHandBatch& batch, PokerHandRank* ranks) {
+    PokerHandRankEvaluator::evaluate_batch(batch, ranks);
+}
+
+std::tuple<PokerHand, PokerHandEvaluation> PokerHandEvaluator::evaluate_hand(CardSet player_cards, CardSet community_cards) {
+
+    // Ensure we have enough cards (this assumes at least 3 community cards are dealt)
+    if (player_cards.count() != 2 || community_cards.count() < 3) {
+        throw std::runtime_error("Not enough cards to evaluate.");
+    }
+    if (player_cards.intersects(community_cards)) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
+
+    PokerHandRank rank = rank_hand(player_cards | community_cards);
+    PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(rank);
+
+    return std::tuple(make_best_hand(player_cards | community_cards, evaluation), evaluation);
+}
+
+PokerHandResult PokerHandEvaluator::determine_winner(CardSet player1_cards, CardSet player2_cards, CardSet community_cards) {
+
+    // Ensure we have enough cards (this assumes all 5 community cards are dealt)
+    if (player1_cards.count() != 2 || player2_cards.count() != 2 || community_cards.count() != 5) {
+        throw std::runtime_error("Not enough cards to evaluate.");
+    }
+    if (player1_cards.intersects(player2_cards) || (player1_cards | player2_cards).intersects(community_cards)) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
 
-    auto [player1_best_hand, player1_best_evaluation] = evaluate_hand(player1_cards, community_cards);
-    auto [player2_best_hand, player2_best_evaluation] = evaluate_hand(player2_cards, community_cards);
+    PokerHandRank player1_rank = rank_hand(player1_cards | community_cards);
+    PokerHandRank player2_rank = rank_hand(player2_cards | community_cards);
 
-    if (player1_best_evaluation > player2_best_evaluation) {
-        return {player1_best_hand, PokerHandWinner::Player1, player1_best_evaluation};
-    } else if (player2_best_evaluation > player1_best_evaluation) {
-        return {player2_best_hand, PokerHandWinner::Player2, player2_best_evaluation};
+    if (player1_rank > player2_rank) {
+        PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(player1_rank);
+        return {make_best_hand(player1_cards | community_cards, evaluation), PokerHandWinner::Player1, evaluation};
+    } else if (player2_rank > player1_rank) {
+        PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(player2_rank);
+        return {make_best_hand(player2_cards | community_cards, evaluation), PokerHandWinner::Player2, evaluation};
     } else {
-        return {std::nullopt, PokerHandWinner::Tie, player1_best_evaluation};
+        return {std::nullopt, PokerHandWinner::Tie, PokerHandRankEvaluator::evaluation(player1_rank)};
     }
 }
@@ -4,8 +4,11 @@
 
 #include "poker_hand.hpp"
 #include "poker_hand_evaluation.hpp"
+#include "poker_hand_rank.hpp"
 
 #include <optional>
+#include <tuple>
+#include <vector>
 
 enum class PokerHandWinner {
     Player1,
@@ -19,6 +22,14 @@ struct PokerHandResult {
     PokerHandEvaluation evaluation;
 };
 
+// Showdown between any number of players. Every player holding the best hand
+// shares the pot.
+struct PokerShowdownResult {
+    // Indexes of the players sharing the pot, in increasing order.
+    std::vector<std::size_t> winners;
+    PokerHandEvaluation evaluation;
+};
+
 class PokerHandEvaluator {
 public:
     static std::tuple<PokerHand, PokerHandEvaluation> evaluate_hand(const std::vector<const Card*>& player_cards,
@@ -27,4 +38,22 @@ public:
     static PokerHandResult determine_winner(const std::vector<const Card*>& player1_cards,
                                             const std::vector<const Card*>& player2_cards,
                                             const std::vector<const Card*>& community_cards);
+
+    static std::tuple<PokerHand, PokerHandEvaluation> evaluate_hand(CardSet player_cards, CardSet community_cards);
+
+    static PokerHandResult determine_winner(CardSet player1_cards, CardSet player2_cards, CardSet community_cards);
+
+    // Showdown of two or more players, each with two hole cards, on a complete board.
+    static PokerShowdownResult determine_winners(const std::vector<std::vector<const Card*>>& players_cards,
+                                                 const std::vector<const Card*>& community_cards);
+    static PokerShowdownResult determine_winners(const std::vector<CardSet>& players_cards, CardSet community_cards);
+
+    // Rebuild the five cards making up an evaluation from the cards it was evaluated on.
+    static PokerHand make_best_hand(const std::vector<const Card*>& player_cards,
+                                    const std::vector<const Card*>& community_cards,
+                                    const PokerHandEvaluation& evaluation);
+    static PokerHand make_best_hand(CardSet cards, const PokerHandEvaluation& evaluation);
+
+    // Rank many independent hands at once. The higher rank wins, as in determine_winner.
+    static void evaluate_batch(const PokerHandBatch& batch, PokerHandRank* ranks);
 };
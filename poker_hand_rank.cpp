@@ -0,0 +1,375 @@
+#include "poker_hand_rank.hpp"
+#include "poker_hand_rank_tables.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define POKER_HAND_RANK_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+using namespace PokerHandRankTables;
+
+// Best non-flush hand that can be made from the given number of cards of each rank.
+std::uint32_t rank_count_strength(const std::array<std::uint8_t, RANK_COUNT>& rank_counts) {
+    unsigned present = 0, pairs = 0, trips = 0, quads = 0;
+    for (int rank = 0; rank < RANK_COUNT; rank++) {
+        unsigned bit = 1u << rank;
+        if (rank_counts[rank] >= 1) present |= bit;
+        if (rank_counts[rank] >= 2) pairs |= bit;
+        if (rank_counts[rank] >= 3) trips |= bit;
+        if (rank_counts[rank] >= 4) quads |= bit;
+    }
+
+    if (quads) {
+        int quad = highest_rank(quads);
+        return StrengthBuilder(FourOfAKind).add(quad + 2).add_highest(present & ~(1u << quad), 1).get();
+    }
+
+    if (trips) {
+        int trip = highest_rank(trips);
+        unsigned other_pairs = pairs & ~(1u << trip);
+        if (other_pairs) {
+            return StrengthBuilder(FullHouse).add(trip + 2).add(highest_rank(other_pairs) + 2).get();
+        }
+    }
+
+    if (int high = straight_high(present)) {
+        return StrengthBuilder(Straight).add(high).get();
+    }
+
+    if (trips) {
+        int trip = highest_rank(trips);
+        return StrengthBuilder(ThreeOfAKind).add(trip + 2).add_highest(present & ~(1u << trip), 2).get();
+    }
+
+    if (std::popcount(pairs) >= 2) {
+        int high_pair = highest_rank(pairs);
+        int low_pair = highest_rank(pairs & ~(1u << high_pair));
+        unsigned kickers = present & ~(1u << high_pair) & ~(1u << low_pair);
+        return StrengthBuilder(TwoPair).add(high_pair + 2).add(low_pair + 2).add_highest(kickers, 1).get();
+    }
+
+    if (pairs) {
+        int pair = highest_rank(pairs);
+        return StrengthBuilder(OnePair).add(pair + 2).add_highest(present & ~(1u << pair), 3).get();
+    }
+
+    return StrengthBuilder(HighCard).add_highest(present, 5).get();
+}
+
+// Rank of the best non-flush hand, indexed by card count then quinary hash. These
+// tables are too large to build at compile time and are filled in on first use.
+class RankCountRanks {
+public:
+    RankCountRanks();
+
+    const std::vector<PokerHandRank>& operator[](int card_count) const {
+        return ranks_[card_count];
+    }
+
+private:
+    std::array<std::vector<PokerHandRank>, MAX_CARDS + 1> ranks_;
+};
+
+RankCountRanks::RankCountRanks() {
+    // Visit every combination of rank counts for each card count.
+    for (int card_count = MIN_CARDS; card_count <= MAX_CARDS; card_count++) {
+        std::vector<PokerHandRank>& ranks = ranks_[card_count];
+        // One padding entry keeps 32 bit gathers in bounds.
+        ranks.assign(quinary_counts[RANK_COUNT][card_count] + 1, 0);
+
+        std::array<std::uint8_t, RANK_COUNT> rank_counts{};
+        auto visit = [&](auto& self, int rank, int remaining) -> void {
+            if (rank == RANK_COUNT) {
+                if (remaining == 0) {
+                    ranks[quinary_hash(rank_counts, card_count)] = rank_of(rank_count_strength(rank_counts));
+                }
+                return;
+            }
+            for (int count = 0; count <= std::min(remaining, MAX_SAME_RANK); count++) {
+                rank_counts[rank] = count;
+                self(self, rank + 1, remaining - count);
+            }
+            rank_counts[rank] = 0;
+        };
+        visit(visit, 0, card_count);
+    }
+}
+
+const RankCountRanks& rank_count_ranks() {
+    static const RankCountRanks ranks;
+    return ranks;
+}
+
+PokerHandRank rank_cards(const std::array<std::uint8_t, RANK_COUNT>& rank_counts,
+                         const std::array<unsigned, SUIT_COUNT>& suit_masks,
+                         int card_count) {
+    // At most one suit can hold five of seven cards, and no full house or
+    // four of a kind can then be made from the remaining two.
+    for (unsigned suit_mask : suit_masks) {
+        if (std::popcount(suit_mask) >= FLUSH_SIZE) {
+            return flush_ranks[suit_mask];
+        }
+    }
+
+    return rank_count_ranks()[card_count][quinary_hash(rank_counts, card_count)];
+}
+
+// Rank counts and per-suit rank masks of the cards seen so far.
+struct CardCounts {
+    std::array<std::uint8_t, RANK_COUNT> rank_counts{};
+    std::array<unsigned, SUIT_COUNT> suit_masks{};
+    int card_count = 0;
+
+    void add(const std::vector<const Card*>& cards) {
+        for (const Card* card : cards) {
+            add(static_cast<int>(card->get_suit()), card->get_value() - 2);
+        }
+    }
+
+    void add(CardSet cards) {
+        for (Suit suit : suits) {
+            unsigned suit_mask = cards.suit_mask(suit);
+            suit_masks[static_cast<int>(suit)] |= suit_mask;
+            for (unsigned mask = suit_mask; mask != 0; mask &= mask - 1) {
+                rank_counts[std::countr_zero(mask)]++;
+            }
+        }
+        card_count += cards.count();
+    }
+
+    void add(int suit, int rank) {
+        rank_counts[rank]++;
+        suit_masks[suit] |= 1u << rank;
+        card_count++;
+    }
+
+    PokerHandRank rank() const {
+        if (card_count < MIN_CARDS || card_count > MAX_CARDS) {
+            throw std::runtime_error("Poker hand rank requires 5 to 7 cards.");
+        }
+        return rank_cards(rank_counts, suit_masks, card_count);
+    }
+};
+
+void evaluate_batch_scalar(const std::vector<const std::uint8_t*>& cards, std::size_t begin, std::size_t end, PokerHandRank* ranks) {
+    for (std::size_t i = begin; i < end; i++) {
+        CardCounts counts;
+        for (const std::uint8_t* card : cards) {
+            counts.add(card[i] / RANK_COUNT, card[i] % RANK_COUNT);
+        }
+        ranks[i] = counts.rank();
+    }
+}
+
+#ifdef POKER_HAND_RANK_AVX2
+
+bool cpu_supports_avx2() {
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+// Ranks eight hands per iteration, one per 32 bit lane. Returns the number of
+// hands ranked, leaving the remainder (fewer than eight) to the scalar loop.
+__attribute__((target("avx2")))
+std::size_t evaluate_batch_avx2(const std::vector<const std::uint8_t*>& cards, std::size_t size, PokerHandRank* ranks) {
+    const int card_count = static_cast<int>(cards.size());
+    const int* quinary_offset_table = reinterpret_cast<const int*>(quinary_offsets.data());
+    const int* rank_count_table = reinterpret_cast<const int*>(rank_count_ranks()[card_count].data());
+    const int* flush_rank_table = reinterpret_cast<const int*>(flush_ranks.data());
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i rank_mask = _mm256_set1_epi32(RANK_MASK_COUNT - 1);
+    const __m256i low_half = _mm256_set1_epi32(0xffff);
+
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        __m256i rank_counts[RANK_COUNT];
+        for (__m256i& rank_count : rank_counts) {
+            rank_count = zero;
+        }
+
+        // Rank masks of suits 0 and 1 (low) and 2 and 3 (high), 16 bits per suit,
+        // and the number of cards of each suit, 8 bits per suit.
+        __m256i suit_masks_low = zero;
+        __m256i suit_masks_high = zero;
+        __m256i suit_counts = zero;
+
+        for (const std::uint8_t* card : cards) {
+            __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(card + i)));
+            // index / 13 for every index below 52.
+            __m256i suit = _mm256_srli_epi32(_mm256_mullo_epi32(index, _mm256_set1_epi32(79)), 10);
+            __m256i rank = _mm256_sub_epi32(index, _mm256_mullo_epi32(suit, _mm256_set1_epi32(RANK_COUNT)));
+
+            for (int r = 0; r < RANK_COUNT; r++) {
+                rank_counts[r] = _mm256_sub_epi32(rank_counts[r], _mm256_cmpeq_epi32(rank, _mm256_set1_epi32(r)));
+            }
+
+            __m256i bit = _mm256_sllv_epi32(one, _mm256_add_epi32(rank, _mm256_slli_epi32(_mm256_and_si256(suit, one), 4)));
+            __m256i high_suit = _mm256_cmpgt_epi32(suit, one);
+            suit_masks_low = _mm256_or_si256(suit_masks_low, _mm256_andnot_si256(high_suit, bit));
+            suit_masks_high = _mm256_or_si256(suit_masks_high, _mm256_and_si256(high_suit, bit));
+            suit_counts = _mm256_add_epi32(suit_counts, _mm256_sllv_epi32(one, _mm256_slli_epi32(suit, 3)));
+        }
+
+        __m256i remaining = _mm256_set1_epi32(card_count);
+        __m256i hash = zero;
+        for (int r = 0; r < RANK_COUNT; r++) {
+            __m256i offset_index = _mm256_add_epi32(
+                _mm256_mullo_epi32(rank_counts[r], _mm256_set1_epi32(RANK_COUNT * (MAX_CARDS + 1))),
+                _mm256_add_epi32(_mm256_set1_epi32((RANK_COUNT - r - 1) * (MAX_CARDS + 1)), remaining));
+            hash = _mm256_add_epi32(hash, _mm256_i32gather_epi32(quinary_offset_table, offset_index, 4));
+            remaining = _mm256_sub_epi32(remaining, rank_counts[r]);
+        }
+        __m256i result = _mm256_and_si256(_mm256_i32gather_epi32(rank_count_table, hash, 2), low_half);
+
+        // A suit count byte reaches 8 after adding 3 only if it holds five or more cards.
+        __m256i flush_flags = _mm256_and_si256(_mm256_add_epi32(suit_counts, _mm256_set1_epi32(0x03030303)),
+                                               _mm256_set1_epi32(0x08080808));
+        if (!_mm256_testz_si256(flush_flags, flush_flags)) {
+            const __m256i suit_masks[SUIT_COUNT] = {
+                _mm256_and_si256(suit_masks_low, rank_mask),
+                _mm256_and_si256(_mm256_srli_epi32(suit_masks_low, 16), rank_mask),
+                _mm256_and_si256(suit_masks_high, rank_mask),
+                _mm256_and_si256(_mm256_srli_epi32(suit_masks_high, 16), rank_mask),
+            };
+
+            __m256i flush_mask = zero;
+            for (int s = 0; s < SUIT_COUNT; s++) {
+                __m256i flag = _mm256_set1_epi32(0x08 << (8 * s));
+                __m256i is_suit = _mm256_cmpeq_epi32(_mm256_and_si256(flush_flags, flag), flag);
+                flush_mask = _mm256_or_si256(flush_mask, _mm256_and_si256(is_suit, suit_masks[s]));
+            }
+
+            __m256i is_flush = _mm256_cmpgt_epi32(flush_flags, zero);
+            __m256i flush_rank = _mm256_and_si256(
+                _mm256_mask_i32gather_epi32(zero, flush_rank_table, flush_mask, is_flush, 2), low_half);
+            result = _mm256_blendv_epi8(result, flush_rank, is_flush);
+        }
+
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ranks + i), _mm256_castsi256_si128(packed));
+    }
+
+    return i;
+}
+
+#endif
+
+} // namespace
+
+PokerHandRank PokerHandRankEvaluator::evaluate(const std::vector<const Card*>& cards) {
+    CardCounts counts;
+    counts.add(cards);
+    return counts.rank();
+}
+
+PokerHandRank PokerHandRankEvaluator::evaluate(const std::vector<const Card*>& player_cards,
+                                               const std::vector<const Card*>& community_cards) {
+    CardCounts counts;
+    counts.add(player_cards);
+    counts.add(community_cards);
+    return counts.rank();
+}
+
+PokerHandRank PokerHandRankEvaluator::evaluate(CardSet cards) {
+    CardCounts counts;
+    counts.add(cards);
+    return counts.rank();
+}
+
+void PokerHandRankEvaluator::evaluate_batch(const PokerHandBatch& batch, PokerHandRank* ranks) {
+    if (batch.community_card_count < 3 || batch.community_card_count > batch.community_cards.size()) {
+        throw std::runtime_error("Poker hand rank requires 5 to 7 cards.");
+    }
+
+    std::vector<const std::uint8_t*> cards(batch.hole_cards.begin(), batch.hole_cards.end());
+    cards.insert(cards.end(), batch.community_cards.begin(), batch.community_cards.begin() + batch.community_card_count);
+
+    std::size_t ranked = 0;
+#ifdef POKER_HAND_RANK_AVX2
+    if (cpu_supports_avx2()) {
+        ranked = evaluate_batch_avx2(cards, batch.size, ranks);
+    }
+#endif
+    evaluate_batch_scalar(cards, ranked, batch.size, ranks);
+}
+
+PokerHandEvaluationCategory PokerHandRankEvaluator::category(PokerHandRank rank) {
+    return static_cast<PokerHandEvaluationCategory>(strengths.at(rank) >> POKER_HAND_CATEGORY_SHIFT);
+}
+
+PokerHandEvaluation PokerHandRankEvaluator::evaluation(PokerHandRank rank) {
+    return {category(rank), strengths.at(rank)};
+}
+
+IncrementalPokerHandEvaluator::IncrementalPokerHandEvaluator()
+    : rank_counts_{}
+    , suit_masks_{}
+    , rank_(0) {}
+
+IncrementalPokerHandEvaluator::IncrementalPokerHandEvaluator(const std::vector<const Card*>& hole_cards)
+    : IncrementalPokerHandEvaluator() {
+    add_cards(hole_cards);
+}
+
+void IncrementalPokerHandEvaluator::add_card(const Card* card) {
+    add_card_counts(card);
+    update_rank();
+}
+
+void IncrementalPokerHandEvaluator::add_cards(const std::vector<const Card*>& cards) {
+    for (const Card* card : cards) {
+        add_card_counts(card);
+    }
+    update_rank();
+}
+
+void IncrementalPokerHandEvaluator::clear() {
+    *this = IncrementalPokerHandEvaluator();
+}
+
+CardSet IncrementalPokerHandEvaluator::cards() const {
+    return cards_;
+}
+
+std::size_t IncrementalPokerHandEvaluator::card_count() const {
+    return cards_.count();
+}
+
+PokerHandRank IncrementalPokerHandEvaluator::rank() const {
+    return rank_;
+}
+
+PokerHandEvaluation IncrementalPokerHandEvaluator::evaluation() const {
+    if (rank_ == 0) {
+        throw std::runtime_error("Not enough cards to evaluate.");
+    }
+    return PokerHandRankEvaluator::evaluation(rank_);
+}
+
+void IncrementalPokerHandEvaluator::add_card_counts(const Card* card) {
+    if (cards_.contains(card)) {
+        return;
+    }
+    if (cards_.count() == MAX_CARDS) {
+        throw std::runtime_error("Poker hand rank requires 5 to 7 cards.");
+    }
+
+    int rank = card->get_value() - 2;
+    rank_counts_[rank]++;
+    suit_masks_[static_cast<int>(card->get_suit())] |= 1u << rank;
+    cards_.add(card);
+}
+
+void IncrementalPokerHandEvaluator::update_rank() {
+    int card_count = static_cast<int>(cards_.count());
+    rank_ = card_count >= MIN_CARDS ? rank_cards(rank_counts_, suit_masks_, card_count) : 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "card.hpp"
+#include "card_set.hpp"
+#include "poker_hand_evaluation.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Equivalence class of a poker hand, from 1 (7-5-4-3-2 unsuited) to 7462 (royal flush).
+// The higher, the better. Hands of equal rank split the pot.
+using PokerHandRank = std::uint16_t;
+
+constexpr PokerHandRank POKER_HAND_RANK_COUNT = 7462;
+
+// Structure-of-arrays batch of independent hands: entry i of every array belongs
+// to hand i, and each card is given by its Card::get_index.
+struct PokerHandBatch {
+    std::array<const std::uint8_t*, 2> hole_cards;
+    std::array<const std::uint8_t*, 5> community_cards;
+    std::size_t community_card_count;
+    std::size_t size;
+};
+
+// Scores 5 to 7 cards directly with precomputed flush and rank-count tables,
+// without enumerating the five card combinations.
+class PokerHandRankEvaluator {
+public:
+    static PokerHandRank evaluate(const std::vector<const Card*>& cards);
+    static PokerHandRank evaluate(const std::vector<const Card*>& player_cards,
+                                  const std::vector<const Card*>& community_cards);
+    static PokerHandRank evaluate(CardSet cards);
+
+    // Rank every hand of the batch into ranks[0..size), using AVX2 when the CPU has it.
+    static void evaluate_batch(const PokerHandBatch& batch, PokerHandRank* ranks);
+
+    static PokerHandEvaluationCategory category(PokerHandRank rank);
+    static PokerHandEvaluation evaluation(PokerHandRank rank);
+};
+
+// Rank of a hand that grows one street at a time: start from the hole cards and
+// add the community cards as they are dealt. Each added card costs a fixed
+// number of table lookups, and the current rank is cached.
+class IncrementalPokerHandEvaluator {
+public:
+    IncrementalPokerHandEvaluator();
+    explicit IncrementalPokerHandEvaluator(const std::vector<const Card*>& hole_cards);
+
+    // Cards already added are ignored.
+    void add_card(const Card* card);
+    void add_cards(const std::vector<const Card*>& cards);
+    void clear();
+
+    CardSet cards() const;
+    std::size_t card_count() const;
+
+    // Rank of the best hand so far, or 0 while fewer than five cards were added.
+    PokerHandRank rank() const;
+    PokerHandEvaluation evaluation() const;
+
+private:
+    void add_card_counts(const Card* card);
+    void update_rank();
+
+    std::array<std::uint8_t, 13> rank_counts_;
+    std::array<unsigned, 4> suit_masks_;
+    CardSet cards_;
+    PokerHandRank rank_;
+};
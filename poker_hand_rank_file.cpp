@@ -0,0 +1,276 @@
+#include "poker_hand_rank_file.hpp"
+
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define POKER_HAND_RANK_FILE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr int RANK_COUNT = 13;
+constexpr int SUIT_COUNT = 4;
+constexpr int MIN_CARDS = 5;
+constexpr int MAX_CARDS = 7;
+constexpr int MAX_SAME_RANK = 4;
+constexpr int FLUSH_SIZE = 5;
+constexpr std::uint32_t ROW_SIZE = DECK_SIZE + 1;
+
+constexpr char MAGIC[8] = {'P', 'K', 'R', 'A', 'N', 'K', 'S', '\0'};
+constexpr std::uint32_t VERSION = 1;
+
+struct RankFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t row_size;
+    std::uint64_t entry_count;
+    std::uint64_t checksum;
+};
+
+// 64 bit FNV-1a over the entries.
+std::uint64_t checksum(const std::uint32_t* entries, std::size_t entry_count) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < entry_count; i++) {
+        hash ^= entries[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Cards of a state as far as they matter for the final rank: the number of cards
+// of each rank, and the ranks of the suits that can still make a flush. The other
+// suits are cleared, so that hands differing only by them share a state.
+struct RankFileState {
+    std::array<std::uint8_t, RANK_COUNT> rank_counts{};
+    std::array<unsigned, SUIT_COUNT> suit_masks{};
+    int card_count = 0;
+
+    // Returns false if the card cannot be added (already in the state).
+    bool add(int suit, int rank) {
+        if (rank_counts[rank] == MAX_SAME_RANK || (suit_masks[suit] & (1u << rank))) {
+            return false;
+        }
+        rank_counts[rank]++;
+        suit_masks[suit] |= 1u << rank;
+        card_count++;
+
+        for (unsigned& suit_mask : suit_masks) {
+            if (std::popcount(suit_mask) + MAX_CARDS - card_count < FLUSH_SIZE) {
+                suit_mask = 0;
+            }
+        }
+        return true;
+    }
+
+    // Rank of five or more cards. The cleared suits get the cards not in a flush
+    // suit, spread so that none of them holds five.
+    PokerHandRank rank() const {
+        std::array<int, SUIT_COUNT> cleared_suits{};
+        int cleared_count = 0;
+        CardSet cards;
+        for (int suit = 0; suit < SUIT_COUNT; suit++) {
+            if (suit_masks[suit] == 0) {
+                cleared_suits[cleared_count++] = suit;
+            }
+            cards |= CardSet(std::uint64_t{suit_masks[suit]} << (suit * RANK_COUNT));
+        }
+
+        int next_suit = 0;
+        for (int rank = 0; rank < RANK_COUNT; rank++) {
+            int remaining = rank_counts[rank];
+            for (unsigned suit_mask : suit_masks) {
+                remaining -= (suit_mask >> rank) & 1;
+            }
+            if (remaining > cleared_count) {
+                return 0;
+            }
+            for (; remaining > 0; remaining--) {
+                cards |= CardSet::from_index(cleared_suits[next_suit] * RANK_COUNT + rank);
+                next_suit = (next_suit + 1) % cleared_count;
+            }
+        }
+        return PokerHandRankEvaluator::evaluate(cards);
+    }
+
+    std::pair<std::uint64_t, std::uint64_t> key() const {
+        std::uint64_t counts = 0;
+        for (std::uint8_t count : rank_counts) {
+            counts = counts * (MAX_SAME_RANK + 1) + count;
+        }
+        std::uint64_t masks = 0;
+        for (unsigned suit_mask : suit_masks) {
+            masks = (masks << RANK_COUNT) | suit_mask;
+        }
+        return {counts, masks};
+    }
+};
+
+struct RankFileKeyHash {
+    std::size_t operator()(const std::pair<std::uint64_t, std::uint64_t>& key) const {
+        return std::hash<std::uint64_t>()(key.first * 0x9e3779b97f4a7c15ull ^ key.second);
+    }
+};
+
+} // namespace
+
+PokerHandRankFile::PokerHandRankFile(const std::string& path)
+    : mapping_(nullptr)
+    , mapping_size_(0)
+    , entries_(nullptr)
+    , entry_count_(0) {
+#ifdef POKER_HAND_RANK_FILE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open poker hand rank file " + path + ".");
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size < (off_t)sizeof(RankFileHeader)) {
+        close(fd);
+        throw std::runtime_error("Invalid poker hand rank file " + path + ".");
+    }
+
+    mapping_size_ = file_stat.st_size;
+    mapping_ = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error("Cannot map poker hand rank file " + path + ".");
+    }
+
+    RankFileHeader header;
+    std::memcpy(&header, mapping_, sizeof(header));
+    entries_ = reinterpret_cast<const std::uint32_t*>(static_cast<const char*>(mapping_) + sizeof(header));
+    entry_count_ = header.entry_count;
+
+    bool valid = std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0
+        && header.version == VERSION
+        && header.row_size == ROW_SIZE
+        && entry_count_ % ROW_SIZE == 0
+        && mapping_size_ == sizeof(header) + entry_count_ * sizeof(std::uint32_t)
+        && header.checksum == checksum(entries_, entry_count_);
+    if (!valid) {
+        munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+        throw std::runtime_error("Invalid poker hand rank file " + path + ".");
+    }
+#else
+    throw std::runtime_error("Poker hand rank files are not supported on this platform.");
+#endif
+}
+
+PokerHandRankFile::~PokerHandRankFile() {
+#ifdef POKER_HAND_RANK_FILE_MMAP
+    if (mapping_) {
+        munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+const PokerHandRankFile* PokerHandRankFile::shared() {
+    static const std::unique_ptr<const PokerHandRankFile> rank_file = []() -> std::unique_ptr<const PokerHandRankFile> {
+        const char* path = std::getenv(PATH_VARIABLE);
+        try {
+            return std::make_unique<const PokerHandRankFile>(path ? path : DEFAULT_PATH);
+        } catch (const std::runtime_error&) {
+            return nullptr;
+        }
+    }();
+    return rank_file.get();
+}
+
+void PokerHandRankFile::generate(const std::string& path) {
+    std::vector<RankFileState> states(1);
+    std::vector<std::uint32_t> entries(ROW_SIZE, 0);
+    std::unordered_map<std::pair<std::uint64_t, std::uint64_t>, std::uint32_t, RankFileKeyHash> state_ids;
+
+    // States are numbered by card count, so rows only point to later rows.
+    for (std::uint32_t id = 0; id < states.size(); id++) {
+        // Copied, as adding states may move them.
+        const RankFileState state = states[id];
+        if (state.card_count >= MIN_CARDS) {
+            entries[id * ROW_SIZE] = state.rank();
+        }
+
+        for (std::size_t index = 0; index < DECK_SIZE; index++) {
+            RankFileState next = state;
+            if (!next.add(index / RANK_COUNT, index % RANK_COUNT)) {
+                continue;
+            }
+
+            if (next.card_count == MAX_CARDS) {
+                entries[id * ROW_SIZE + 1 + index] = next.rank();
+                continue;
+            }
+
+            auto [it, inserted] = state_ids.try_emplace(next.key(), static_cast<std::uint32_t>(states.size()));
+            if (inserted) {
+                states.push_back(next);
+                entries.resize(states.size() * ROW_SIZE, 0);
+            }
+            entries[id * ROW_SIZE + 1 + index] = it->second * ROW_SIZE;
+        }
+    }
+
+    RankFileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.row_size = ROW_SIZE;
+    header.entry_count = entries.size();
+    header.checksum = checksum(entries.data(), entries.size());
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(std::uint32_t));
+    if (!file) {
+        throw std::runtime_error("Cannot write poker hand rank file " + path + ".");
+    }
+}
+
+PokerHandRank PokerHandRankFile::evaluate(CardSet cards) const {
+    std::uint32_t offset = 0;
+    for (std::uint64_t mask = cards.mask(); mask != 0; mask &= mask - 1) {
+        offset = entries_[offset + 1 + std::countr_zero(mask)];
+    }
+    return rank(offset, cards.count());
+}
+
+PokerHandRank PokerHandRankFile::evaluate(const std::vector<const Card*>& player_cards,
+                                          const std::vector<const Card*>& community_cards) const {
+    // A repeated card would follow the graph's entry back to the start and give a
+    // wrong rank.
+    if ((CardSet(player_cards) | CardSet(community_cards)).count() != player_cards.size() + community_cards.size()) {
+        throw std::runtime_error("Duplicate cards to evaluate.");
+    }
+
+    std::uint32_t offset = 0;
+    for (const Card* card : player_cards) {
+        offset = entries_[offset + 1 + card->get_index()];
+    }
+    for (const Card* card : community_cards) {
+        offset = entries_[offset + 1 + card->get_index()];
+    }
+    return rank(offset, player_cards.size() + community_cards.size());
+}
+
+std::size_t PokerHandRankFile::state_count() const {
+    return entry_count_ / ROW_SIZE;
+}
+
+PokerHandRank PokerHandRankFile::rank(std::uint32_t offset, std::size_t card_count) const {
+    if (card_count < MIN_CARDS || card_count > MAX_CARDS) {
+        throw std::runtime_error("Poker hand rank requires 5 to 7 cards.");
+    }
+    return static_cast<PokerHandRank>(card_count == MAX_CARDS ? offset : entries_[offset]);
+}
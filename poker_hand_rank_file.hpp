@@ -0,0 +1,52 @@
+#pragma once
+
+#include "card.hpp"
+#include "card_set.hpp"
+#include "poker_hand_rank.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Precomputed rank of every 5 to 7 card hand, stored as a lookup graph read one
+// card at a time: each state has a row of 53 entries, and entry 1 + card index
+// holds the offset of the next row, or the rank once the seventh card is added.
+// Entry 0 holds the rank of a five or six card state. The file is about 130 MB,
+// written by the generate_rank_file tool and memory mapped, so every process on
+// the host shares the same pages.
+class PokerHandRankFile {
+public:
+    static constexpr const char* DEFAULT_PATH = "poker_hand_ranks.dat";
+    // Environment variable overriding DEFAULT_PATH.
+    static constexpr const char* PATH_VARIABLE = "POKER_HAND_RANK_FILE";
+
+    // Map the file and check its header and checksum. Throws if the file is
+    // missing or invalid.
+    explicit PokerHandRankFile(const std::string& path);
+    ~PokerHandRankFile();
+
+    PokerHandRankFile(const PokerHandRankFile&) = delete;
+    PokerHandRankFile& operator=(const PokerHandRankFile&) = delete;
+
+    // The rank file of this process, opened on first use, or nullptr when there
+    // is no valid file and the in-process evaluator must be used.
+    static const PokerHandRankFile* shared();
+
+    // Build the lookup graph and write it to path.
+    static void generate(const std::string& path);
+
+    // Rank 5 to 7 distinct cards.
+    PokerHandRank evaluate(CardSet cards) const;
+    PokerHandRank evaluate(const std::vector<const Card*>& player_cards,
+                           const std::vector<const Card*>& community_cards) const;
+
+    std::size_t state_count() const;
+
+private:
+    PokerHandRank rank(std::uint32_t offset, std::size_t card_count) const;
+
+    void* mapping_;
+    std::size_t mapping_size_;
+    const std::uint32_t* entries_;
+    std::size_t entry_count_;
+};
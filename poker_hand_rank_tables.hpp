@@ -0,0 +1,266 @@
+#pragma once
+
+#include "poker_hand_evaluation.hpp"
+#include "poker_hand_rank.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+// Lookup tables of PokerHandRankEvaluator that are small enough to be built by the
+// compiler. They are constant data of the executable: nothing is computed at startup.
+namespace PokerHandRankTables {
+
+constexpr int RANK_COUNT = 13;
+constexpr int SUIT_COUNT = 4;
+constexpr int MIN_CARDS = 5;
+constexpr int MAX_CARDS = 7;
+constexpr int MAX_SAME_RANK = 4;
+constexpr int FLUSH_SIZE = 5;
+constexpr unsigned RANK_MASK_COUNT = 1 << RANK_COUNT;
+
+// Packs a category and its kicker values (2-14, most significant first) into a
+// PokerHandEvaluation strength.
+class StrengthBuilder {
+public:
+    constexpr explicit StrengthBuilder(PokerHandEvaluationCategory category)
+        : strength_(static_cast<std::uint32_t>(category) << POKER_HAND_CATEGORY_SHIFT)
+        , shift_(POKER_HAND_CATEGORY_SHIFT) {}
+
+    constexpr StrengthBuilder& add(int value) {
+        shift_ -= POKER_HAND_TIEBREAKER_BITS;
+        strength_ |= static_cast<std::uint32_t>(value) << shift_;
+        return *this;
+    }
+
+    // Add the highest count ranks of a 13 bit rank mask.
+    constexpr StrengthBuilder& add_highest(unsigned rank_mask, int count) {
+        for (int rank = RANK_COUNT - 1; rank >= 0 && count > 0; rank--) {
+            if (rank_mask & (1u << rank)) {
+                add(rank + 2);
+                count--;
+            }
+        }
+        return *this;
+    }
+
+    constexpr std::uint32_t get() const {
+        return strength_;
+    }
+
+private:
+    std::uint32_t strength_;
+    int shift_;
+};
+
+// Returns highest card value of the straight in the rank mask, or 0 if not a straight.
+constexpr int straight_high(unsigned rank_mask) {
+    for (int high = RANK_COUNT - 1; high >= 4; high--) {
+        unsigned run = 0x1fu << (high - 4);
+        if ((rank_mask & run) == run) {
+            return high + 2;
+        }
+    }
+
+    // Special case: Ace, 2, 3, 4, 5.
+    constexpr unsigned wheel = 0x100f;
+    if ((rank_mask & wheel) == wheel) {
+        return 5;
+    }
+
+    return 0;
+}
+
+constexpr int highest_rank(unsigned rank_mask) {
+    return std::bit_width(rank_mask) - 1;
+}
+
+// Next larger rank mask with the same number of ranks.
+constexpr unsigned next_rank_mask(unsigned rank_mask) {
+    unsigned lowest = rank_mask & (~rank_mask + 1);
+    unsigned ripple = rank_mask + lowest;
+    return ripple | (((rank_mask ^ ripple) >> 2) / lowest);
+}
+
+// Calls visit with every rank mask of count ranks, from the weakest to the strongest.
+template <typename Visit>
+constexpr void for_each_rank_mask(int count, Visit visit) {
+    for (unsigned mask = (1u << count) - 1; mask < RANK_MASK_COUNT; mask = next_rank_mask(mask)) {
+        visit(mask);
+    }
+}
+
+// Best flush or straight flush in a suit holding five cards.
+constexpr std::uint32_t flush_strength(unsigned rank_mask) {
+    if (int high = straight_high(rank_mask)) {
+        return StrengthBuilder(StraightFlush).add(high).get();
+    }
+    return StrengthBuilder(Flush).add_highest(rank_mask, 5).get();
+}
+
+using Strengths = std::array<std::uint32_t, POKER_HAND_RANK_COUNT + 1>;
+
+// Lists the strength of every equivalence class from the weakest to the strongest.
+constexpr Strengths make_strengths() {
+    Strengths strengths{};
+    std::size_t size = 1;
+
+    auto add_unpaired = [&](PokerHandEvaluationCategory category) {
+        for_each_rank_mask(5, [&](unsigned mask) {
+            if (!straight_high(mask)) {
+                strengths[size++] = StrengthBuilder(category).add_highest(mask, 5).get();
+            }
+        });
+    };
+
+    auto add_straights = [&](PokerHandEvaluationCategory category) {
+        for (int high = 5; high <= (int)Rank::Ace; high++) {
+            strengths[size++] = StrengthBuilder(category).add(high).get();
+        }
+    };
+
+    add_unpaired(HighCard);
+
+    for (int pair = 0; pair < RANK_COUNT; pair++) {
+        for_each_rank_mask(3, [&](unsigned kickers) {
+            if (!(kickers & (1u << pair))) {
+                strengths[size++] = StrengthBuilder(OnePair).add(pair + 2).add_highest(kickers, 3).get();
+            }
+        });
+    }
+
+    for (int high_pair = 1; high_pair < RANK_COUNT; high_pair++) {
+        for (int low_pair = 0; low_pair < high_pair; low_pair++) {
+            for (int kicker = 0; kicker < RANK_COUNT; kicker++) {
+                if (kicker != high_pair && kicker != low_pair) {
+                    strengths[size++] = StrengthBuilder(TwoPair).add(high_pair + 2).add(low_pair + 2).add(kicker + 2).get();
+                }
+            }
+        }
+    }
+
+    for (int trip = 0; trip < RANK_COUNT; trip++) {
+        for_each_rank_mask(2, [&](unsigned kickers) {
+            if (!(kickers & (1u << trip))) {
+                strengths[size++] = StrengthBuilder(ThreeOfAKind).add(trip + 2).add_highest(kickers, 2).get();
+            }
+        });
+    }
+
+    add_straights(Straight);
+    add_unpaired(Flush);
+
+    for (int trip = 0; trip < RANK_COUNT; trip++) {
+        for (int pair = 0; pair < RANK_COUNT; pair++) {
+            if (pair != trip) {
+                strengths[size++] = StrengthBuilder(FullHouse).add(trip + 2).add(pair + 2).get();
+            }
+        }
+    }
+
+    for (int quad = 0; quad < RANK_COUNT; quad++) {
+        for (int kicker = 0; kicker < RANK_COUNT; kicker++) {
+            if (kicker != quad) {
+                strengths[size++] = StrengthBuilder(FourOfAKind).add(quad + 2).add(kicker + 2).get();
+            }
+        }
+    }
+
+    add_straights(StraightFlush);
+
+    if (size != strengths.size()) {
+        throw std::logic_error("Wrong number of poker hand equivalence classes.");
+    }
+    return strengths;
+}
+
+// Strength of every equivalence class, indexed by rank (index 0 is unused).
+inline constexpr Strengths strengths = make_strengths();
+
+constexpr PokerHandRank rank_of(std::uint32_t strength) {
+    auto it = std::lower_bound(strengths.begin() + 1, strengths.end(), strength);
+    return static_cast<PokerHandRank>(it - strengths.begin());
+}
+
+// One padding entry keeps 32 bit gathers in bounds.
+using FlushRanks = std::array<PokerHandRank, RANK_MASK_COUNT + 1>;
+
+constexpr FlushRanks make_flush_ranks() {
+    FlushRanks flush_ranks{};
+    for_each_rank_mask(FLUSH_SIZE, [&](unsigned mask) {
+        flush_ranks[mask] = rank_of(flush_strength(mask));
+    });
+
+    // Six or seven suited cards: the best flush leaving one of them out. Masks
+    // with one rank less are smaller, so they are already filled in.
+    for (unsigned mask = 0; mask < RANK_MASK_COUNT; mask++) {
+        if (std::popcount(mask) > FLUSH_SIZE) {
+            for (unsigned ranks = mask; ranks != 0; ranks &= ranks - 1) {
+                unsigned without = mask & ~(ranks & (~ranks + 1));
+                flush_ranks[mask] = std::max(flush_ranks[mask], flush_ranks[without]);
+            }
+        }
+    }
+    return flush_ranks;
+}
+
+// Rank of the best flush in a suit, indexed by the suit's rank mask.
+inline constexpr FlushRanks flush_ranks = make_flush_ranks();
+
+// quinary_counts[digits][sum]: number of quinaries (digits 0-4) with the given
+// number of digits and digit sum.
+using QuinaryCounts = std::array<std::array<std::uint32_t, MAX_CARDS + 1>, RANK_COUNT + 1>;
+
+constexpr QuinaryCounts make_quinary_counts() {
+    QuinaryCounts quinary_counts{};
+    quinary_counts[0][0] = 1;
+    for (int digits = 1; digits <= RANK_COUNT; digits++) {
+        for (int sum = 0; sum <= MAX_CARDS; sum++) {
+            for (int digit = 0; digit <= std::min(sum, MAX_SAME_RANK); digit++) {
+                quinary_counts[digits][sum] += quinary_counts[digits - 1][sum - digit];
+            }
+        }
+    }
+    return quinary_counts;
+}
+
+inline constexpr QuinaryCounts quinary_counts = make_quinary_counts();
+
+// Perfect hash of the rank counts ("quinary" digits 0-4 summing to the card count):
+// quinary_offsets[digit][remaining digits][remaining sum].
+using QuinaryOffsets = std::array<std::array<std::array<std::uint32_t, MAX_CARDS + 1>, RANK_COUNT>, MAX_SAME_RANK + 1>;
+
+constexpr QuinaryOffsets make_quinary_offsets() {
+    QuinaryOffsets quinary_offsets{};
+    for (int digit = 0; digit <= MAX_SAME_RANK; digit++) {
+        for (int digits = 0; digits < RANK_COUNT; digits++) {
+            for (int sum = 0; sum <= MAX_CARDS; sum++) {
+                for (int smaller = 0; smaller < digit && smaller <= sum; smaller++) {
+                    quinary_offsets[digit][digits][sum] += quinary_counts[digits][sum - smaller];
+                }
+            }
+        }
+    }
+    return quinary_offsets;
+}
+
+inline constexpr QuinaryOffsets quinary_offsets = make_quinary_offsets();
+
+constexpr std::uint32_t quinary_hash(const std::array<std::uint8_t, RANK_COUNT>& rank_counts, int card_count) {
+    std::uint32_t hash = 0;
+    int remaining = card_count;
+    for (int rank = 0; rank < RANK_COUNT && remaining > 0; rank++) {
+        hash += quinary_offsets[rank_counts[rank]][RANK_COUNT - rank - 1][remaining];
+        remaining -= rank_counts[rank];
+    }
+    return hash;
+}
+
+static_assert(strengths[1] == StrengthBuilder(HighCard).add(7).add(5).add(4).add(3).add(2).get());
+static_assert(strengths[POKER_HAND_RANK_COUNT] == StrengthBuilder(StraightFlush).add((int)Rank::Ace).get());
+static_assert(flush_ranks[0x1f00] == POKER_HAND_RANK_COUNT);
+static_assert(quinary_counts[RANK_COUNT][MAX_CARDS] == 49205);
+
+} // namespace PokerHandRankTables
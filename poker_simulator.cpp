@@ -0,0 +1,162 @@
+#include "poker_simulator.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::array<std::size_t, 2> stacks_of(const PokerGame& game) {
+    return {game.get_human_player().chips, game.get_computer_player().chips};
+}
+
+} // namespace
+
+SimulationResult& SimulationResult::operator+=(const SimulationResult& other) {
+    hands += other.hands;
+    rebuys += other.rebuys;
+    showdowns += other.showdowns;
+    ties += other.ties;
+    total_pot += other.total_pot;
+    for (std::size_t seat = 0; seat < wins.size(); seat++) {
+        wins[seat] += other.wins[seat];
+        net_chips[seat] += other.net_chips[seat];
+    }
+    for (std::size_t street = 0; street < streets.size(); street++) {
+        streets[street].actions += other.streets[street].actions;
+        streets[street].decision_time += other.streets[street].decision_time;
+        streets[street].engine_time += other.streets[street].engine_time;
+    }
+    deal_time += other.deal_time;
+    elapsed = std::max(elapsed, other.elapsed);
+    return *this;
+}
+
+double SimulationResult::hands_per_second() const {
+    return elapsed.count() > 0 ? hands / std::chrono::duration<double>(elapsed).count() : 0.0;
+}
+
+double SimulationResult::win_rate(std::size_t seat) const {
+    return hands > 0 ? static_cast<double>(wins.at(seat)) / hands : 0.0;
+}
+
+double SimulationResult::average_pot() const {
+    return hands > 0 ? static_cast<double>(total_pot) / hands : 0.0;
+}
+
+PokerSimulator::PokerSimulator(Difficulty human_seat_difficulty, Difficulty computer_seat_difficulty,
+                               std::uint64_t seed)
+    : game(human_seat_difficulty, computer_seat_difficulty)
+    , engine(game) {
+    // Deal the first hand again, from the seed and the stacks it is known to start from.
+    game.reset_game();
+    game.seed_deck(seed);
+    stacks = stacks_of(game);
+    engine.reset();
+}
+
+SimulationResult PokerSimulator::run(std::uint64_t hands) {
+    SimulationResult result;
+    auto start = Clock::now();
+    for (std::uint64_t hand = 0; hand < hands; hand++) {
+        if (game.has_ended()) {
+            auto deal_start = Clock::now();
+            if (game.get_human_player().chips == 0 || game.get_computer_player().chips == 0) {
+                game.reset_game();
+                stacks = stacks_of(game);
+                engine.reset();
+                result.rebuys++;
+            } else {
+                stacks = stacks_of(game);
+                engine.new_game();
+            }
+            result.deal_time += Clock::now() - deal_start;
+        }
+        play_hand(result);
+    }
+    result.elapsed = Clock::now() - start;
+    return result;
+}
+
+const PokerGame& PokerSimulator::get_game() const {
+    return game;
+}
+
+void PokerSimulator::play_hand(SimulationResult& result) {
+    while (!game.has_ended()) {
+        PlayerType player_type = game.get_player_turn();
+        const Player& player = player_type == PlayerType::Human ? game.get_human_player() : game.get_computer_player();
+        SimulationStreet& street = result.streets[static_cast<std::size_t>(engine.get_stage())];
+
+        auto decision_start = Clock::now();
+        Move move = player.get_move(engine.get_game_state(player_type));
+        auto engine_start = Clock::now();
+        GameAction::Result action = engine.make_move(player_type, move);
+        if (!action.ok && std::holds_alternative<Raise>(move)) {
+            action = engine.make_move(player_type, Call{});
+        }
+        if (!action.ok) {
+            throw std::runtime_error(action.error_message.value_or("Move refused by the engine."));
+        }
+        auto engine_end = Clock::now();
+
+        street.actions++;
+        street.decision_time += engine_start - decision_start;
+        street.engine_time += engine_end - engine_start;
+    }
+
+    result.hands++;
+    if (engine.get_stage() == PokerEngineEnumState::Showdown) {
+        result.showdowns++;
+    }
+    switch (game.get_winner().value()) {
+    case PokerHandWinner::Player1:
+        result.wins[0]++;
+        break;
+    case PokerHandWinner::Player2:
+        result.wins[1]++;
+        break;
+    case PokerHandWinner::Tie:
+        result.ties++;
+        break;
+    }
+    result.total_pot += game.get_pot();
+
+    std::array<std::size_t, 2> final_stacks = stacks_of(game);
+    for (std::size_t seat = 0; seat < stacks.size(); seat++) {
+        result.net_chips[seat] += static_cast<std::int64_t>(final_stacks[seat]) - static_cast<std::int64_t>(stacks[seat]);
+    }
+}
+
+MultiTableSimulator::MultiTableSimulator(Difficulty human_seat_difficulty, Difficulty computer_seat_difficulty,
+                                         std::size_t table_count, std::uint64_t seed)
+    : pool(table_count > 0 ? table_count : std::thread::hardware_concurrency()) {
+    if (table_count == 0) {
+        table_count = pool.thread_count();
+    }
+    for (std::size_t table = 0; table < table_count; table++) {
+        tables.push_back(std::make_unique<PokerSimulator>(human_seat_difficulty, computer_seat_difficulty, seed + table));
+    }
+}
+
+SimulationResult MultiTableSimulator::run(std::uint64_t hands) {
+    std::vector<SimulationResult> results(tables.size());
+    auto start = Clock::now();
+    pool.parallel_for(tables.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t table = begin; table < end; table++) {
+            results[table] = tables[table]->run(hands * (table + 1) / tables.size() - hands * table / tables.size());
+        }
+    });
+
+    SimulationResult result;
+    for (const SimulationResult& table_result : results) {
+        result += table_result;
+    }
+    result.elapsed = Clock::now() - start;
+    return result;
+}
+
+std::size_t MultiTableSimulator::table_count() const {
+    return tables.size();
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "game_constants.hpp"
+#include "poker_engine.hpp"
+#include "poker_game.hpp"
+#include "thread_pool.hpp"
+#include "xoshiro256.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// Time spent on the actions taken in one betting round.
+struct SimulationStreet {
+    std::uint64_t actions = 0;
+    // Spent by the players choosing their moves.
+    std::chrono::nanoseconds decision_time{};
+    // Spent by the engine applying them, dealing the next street included.
+    std::chrono::nanoseconds engine_time{};
+};
+
+struct SimulationResult {
+    // Betting rounds, from PokerEngineEnumState::PreFlop to River.
+    static constexpr std::size_t STREET_COUNT = 4;
+
+    std::uint64_t hands = 0;
+    // Games started again with fresh stacks after a player lost every chip.
+    std::uint64_t rebuys = 0;
+    std::uint64_t showdowns = 0;
+    // Indexed by seat: the human player's seat first.
+    std::array<std::uint64_t, 2> wins{};
+    std::uint64_t ties = 0;
+    // Chips won or lost over the hands played.
+    std::array<std::int64_t, 2> net_chips{};
+    std::uint64_t total_pot = 0;
+
+    std::array<SimulationStreet, STREET_COUNT> streets{};
+    // Spent shuffling, posting the blinds and dealing the hole cards.
+    std::chrono::nanoseconds deal_time{};
+    std::chrono::nanoseconds elapsed{};
+
+    // Add the counts and times of a run played alongside this one. The elapsed
+    // time is the longer of the two.
+    SimulationResult& operator+=(const SimulationResult& other);
+
+    double hands_per_second() const;
+    double win_rate(std::size_t seat) const;
+    double average_pot() const;
+};
+
+// Plays hands between two computer players through the PokerEngine, with no
+// display, to measure the strategies against each other and the engine throughput.
+class PokerSimulator {
+public:
+    // The cards dealt only depend on the seed. The computer players' decisions
+    // have their own randomness.
+    PokerSimulator(Difficulty human_seat_difficulty, Difficulty computer_seat_difficulty,
+                   std::uint64_t seed = Xoshiro256::random_seed());
+
+    // Play the given number of hands on from the current one. Raises the engine
+    // refuses are turned into calls.
+    SimulationResult run(std::uint64_t hands);
+
+    const PokerGame& get_game() const;
+
+private:
+    void play_hand(SimulationResult& result);
+
+    PokerGame game;
+    PokerEngine engine;
+    // Chips of each seat before the current hand was dealt.
+    std::array<std::size_t, 2> stacks;
+};
+
+// Plays hands on several tables at once, each with its own game and engine,
+// spread over a thread pool of its own, and merges the results of the tables.
+// The strategies' parallel loops run inline on the table's thread, so a table
+// never runs another one's hands in the middle of a decision.
+class MultiTableSimulator {
+public:
+    // One thread per table, defaulting to one table per hardware thread. Table i
+    // deals from seed + i.
+    MultiTableSimulator(Difficulty human_seat_difficulty, Difficulty computer_seat_difficulty,
+                        std::size_t table_count = 0, std::uint64_t seed = Xoshiro256::random_seed());
+
+    // Play the given number of hands, shared evenly between the tables. The
+    // elapsed time of the result is the wall clock time of the whole run.
+    SimulationResult run(std::uint64_t hands);
+
+    std::size_t table_count() const;
+
+private:
+    ThreadPool pool;
+    std::vector<std::unique_ptr<PokerSimulator>> tables;
+};
@@ -0,0 +1,112 @@
+#include "preflop_equity.hpp"
+
+#include "equity_calculator.hpp"
+#include "preflop_equity_table.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t RANK_COUNT = 13;
+constexpr std::string_view RANK_CHARS = "23456789TJQKA";
+
+constexpr std::size_t class_size(std::size_t class_index) {
+    std::size_t row = class_index / RANK_COUNT;
+    std::size_t column = class_index % RANK_COUNT;
+    return row == column ? 6 : row > column ? 4 : 12;
+}
+
+using Strengths = std::array<int, PreflopEquity::CLASS_COUNT>;
+
+constexpr Strengths make_strengths() {
+    Strengths strengths{};
+    for (std::size_t c = 0; c < PreflopEquity::CLASS_COUNT; c++) {
+        std::size_t weaker_combos = 0;
+        for (std::size_t other = 0; other < PreflopEquity::CLASS_COUNT; other++) {
+            if (PreflopEquityTable::equities[other] <= PreflopEquityTable::equities[c]) {
+                weaker_combos += class_size(other);
+            }
+        }
+        strengths[c] = static_cast<int>((weaker_combos * 100 + HandRange::COMBO_COUNT / 2) / HandRange::COMBO_COUNT);
+    }
+    return strengths;
+}
+
+constexpr Strengths strengths = make_strengths();
+
+static_assert(PreflopEquityTable::equities.size() == PreflopEquity::CLASS_COUNT);
+
+} // namespace
+
+std::size_t PreflopEquity::class_index(const Card* card1, const Card* card2) {
+    std::size_t rank1 = card1->get_value() - (int)Rank::Two;
+    std::size_t rank2 = card2->get_value() - (int)Rank::Two;
+    std::size_t high = std::max(rank1, rank2);
+    std::size_t low = std::min(rank1, rank2);
+    if (card1->get_suit() == card2->get_suit()) {
+        return high * RANK_COUNT + low;
+    }
+    return low * RANK_COUNT + high;
+}
+
+std::string PreflopEquity::class_name(std::size_t class_index) {
+    if (class_index >= CLASS_COUNT) {
+        throw std::runtime_error("Invalid preflop class.");
+    }
+    std::size_t row = class_index / RANK_COUNT;
+    std::size_t column = class_index % RANK_COUNT;
+    std::string name{RANK_CHARS[std::max(row, column)], RANK_CHARS[std::min(row, column)]};
+    if (row != column) {
+        name += row > column ? 's' : 'o';
+    }
+    return name;
+}
+
+double PreflopEquity::equity(const Card* card1, const Card* card2) {
+    return PreflopEquityTable::equities[class_index(card1, card2)];
+}
+
+int PreflopEquity::strength(const Card* card1, const Card* card2) {
+    return strengths[class_index(card1, card2)];
+}
+
+void PreflopEquity::generate(const std::string& path) {
+    HandRange any_hand;
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        any_hand.set_weight(combo, 1.0);
+    }
+
+    // One pass over every board gives the showdowns of all the combos at once.
+    std::vector<RangeEquityResult> combo_results = EquityCalculator::combo_equity(any_hand, any_hand, CardSet());
+    std::array<RangeEquityResult, CLASS_COUNT> class_results{};
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        CardSet cards = HandRange::combo_cards(combo);
+        std::size_t card1 = cards.first_index();
+        std::size_t card2 = (cards - CardSet::from_index(card1)).first_index();
+        class_results[class_index(Card::get_card(card1), Card::get_card(card2))] += combo_results[combo];
+    }
+
+    std::ofstream file(path);
+    file << "#pragma once\n\n"
+         << "#include <array>\n\n"
+         << "// Generated by the generate_preflop_equity tool, do not edit. Heads-up all-in\n"
+         << "// equity of each preflop class against a random hand, indexed by\n"
+         << "// PreflopEquity::class_index.\n"
+         << "namespace PreflopEquityTable {\n\n"
+         << "inline constexpr std::array<double, " << CLASS_COUNT << "> equities = {\n";
+    for (std::size_t c = 0; c < CLASS_COUNT; c++) {
+        char equity[16];
+        std::snprintf(equity, sizeof(equity), "%.6f", class_results[c].equity());
+        file << "    " << equity << ", // " << class_name(c) << "\n";
+    }
+    file << "};\n\n"
+         << "} // namespace PreflopEquityTable\n";
+
+    if (!file) {
+        throw std::runtime_error("Cannot write preflop equity table " + path + ".");
+    }
+}
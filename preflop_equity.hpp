@@ -0,0 +1,30 @@
+#pragma once
+
+#include "card.hpp"
+
+#include <cstddef>
+#include <string>
+
+// Heads-up all-in equity of the 169 preflop classes (pairs, suited and offsuit
+// hands of two ranks) against a random hand. The values are computed offline by
+// the generate_preflop_equity tool and compiled in from preflop_equity_table.hpp,
+// so a lookup is a single table index.
+class PreflopEquity {
+public:
+    static constexpr std::size_t CLASS_COUNT = 169;
+    static constexpr const char* DEFAULT_PATH = "preflop_equity_table.hpp";
+
+    // Position of the class in a 13 x 13 grid of ranks from Two to Ace: pairs on
+    // the diagonal, suited hands as (high, low) and offsuit hands as (low, high).
+    static std::size_t class_index(const Card* card1, const Card* card2);
+    // Usual name of a class, such as "AA", "AKs" or "AKo".
+    static std::string class_name(std::size_t class_index);
+
+    // Equity of two hole cards, ties counting as half the pot.
+    static double equity(const Card* card1, const Card* card2);
+    // Share of the 1326 starting hands with at most this equity, from 0 to 100.
+    static int strength(const Card* card1, const Card* card2);
+
+    // Compute the equity of every class exactly and write them to path as a C++ header.
+    static void generate(const std::string& path);
+};
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <array>
+
+// Generated by the generate_preflop_equity tool, do not edit. Heads-up all-in
+// equity of each preflop class against a random hand, indexed by
+// PreflopEquity::class_index.
+namespace PreflopEquityTable {
+
+inline constexpr std::array<double, 169> equities = {
+    0.503340, // 22
+    0.323032, // 32o
+    0.331998, // 42o
+    0.342846, // 52o
+    0.340751, // 62o
+    0.345836, // 72o
+    0.368277, // 82o
+    0.390979, // 92o
+    0.416684, // T2o
+    0.443485, // J2o
+    0.472954, // Q2o
+    0.505087, // K2o
+    0.549286, // A2o
+    0.359844, // 32s
+    0.536931, // 33
+    0.351459, // 43o
+    0.362648, // 53o
+    0.360776, // 63o
+    0.366023, // 73o
+    0.374838, // 83o
+    0.400195, // 93o
+    0.425946, // T3o
+    0.452755, // J3o
+    0.482194, // Q3o
+    0.514257, // K3o
+    0.558446, // A3o
+    0.368290, // 42s
+    0.386419, // 43s
+    0.570228, // 44
+    0.381553, // 54o
+    0.380105, // 64o
+    0.385498, // 74o
+    0.394468, // 84o
+    0.406711, // 94o
+    0.435041, // T4o
+    0.461864, // J4o
+    0.491277, // Q4o
+    0.523275, // K4o
+    0.567297, // A4o
+    0.378493, // 52s
+    0.396930, // 53s
+    0.414534, // 54s
+    0.603249, // 55
+    0.399443, // 65o
+    0.405120, // 75o
+    0.414275, // 85o
+    0.426691, // 95o
+    0.442509, // T5o
+    0.471809, // J5o
+    0.501201, // Q5o
+    0.533140, // K5o
+    0.576965, // A5o
+    0.376690, // 62s
+    0.395336, // 63s
+    0.413333, // 64s
+    0.431334, // 65s
+    0.632847, // 66
+    0.423227, // 76o
+    0.432409, // 86o
+    0.444913, // 96o
+    0.460920, // T6o
+    0.478443, // J6o
+    0.510241, // Q6o
+    0.542233, // K6o
+    0.576825, // A6o
+    0.381559, // 72s
+    0.400359, // 73s
+    0.418493, // 74s
+    0.436755, // 75s
+    0.453718, // 76s
+    0.662360, // 77
+    0.450508, // 87o
+    0.462978, // 97o
+    0.479081, // T7o
+    0.496819, // J7o
+    0.517657, // Q7o
+    0.551874, // K7o
+    0.588412, // A7o
+    0.402716, // 82s
+    0.408735, // 83s
+    0.427016, // 84s
+    0.445450, // 85s
+    0.462433, // 86s
+    0.479363, // 87s
+    0.691630, // 88
+    0.480970, // 98o
+    0.497213, // T8o
+    0.514902, // J8o
+    0.535998, // Q8o
+    0.560202, // K8o
+    0.598726, // A8o
+    0.424152, // 92s
+    0.432643, // 93s
+    0.438620, // 94s
+    0.457219, // 95s
+    0.474283, // 96s
+    0.491177, // 97s
+    0.508008, // 98s
+    0.720573, // 99
+    0.515317, // T9o
+    0.532512, // J9o
+    0.553604, // Q9o
+    0.578119, // K9o
+    0.607728, // A9o
+    0.448395, // T2s
+    0.456925, // T3s
+    0.465305, // T4s
+    0.472163, // T5s
+    0.489407, // T6s
+    0.506390, // T7s
+    0.523344, // T8s
+    0.540275, // T9s
+    0.750118, // TT
+    0.552477, // JTo
+    0.572908, // QTo
+    0.597389, // KTo
+    0.627217, // ATo
+    0.473782, // J2s
+    0.482316, // J3s
+    0.490705, // J4s
+    0.499868, // J5s
+    0.506059, // J6s
+    0.523248, // J7s
+    0.540156, // J8s
+    0.556625, // J9s
+    0.575279, // JTs
+    0.774695, // JJ
+    0.581347, // QJo
+    0.605687, // KJo
+    0.635633, // AJo
+    0.501690, // Q2s
+    0.510192, // Q3s
+    0.518553, // Q4s
+    0.527694, // Q5s
+    0.536126, // Q6s
+    0.543023, // Q7s
+    0.560177, // Q8s
+    0.576643, // Q9s
+    0.594676, // QTs
+    0.602592, // QJs
+    0.799252, // QQ
+    0.614558, // KQo
+    0.644318, // AQo
+    0.532117, // K2s
+    0.540550, // K3s
+    0.548846, // K4s
+    0.557929, // K5s
+    0.566407, // K6s
+    0.575377, // K7s
+    0.583123, // K8s
+    0.599885, // K9s
+    0.617886, // KTs
+    0.625673, // KJs
+    0.634004, // KQs
+    0.823957, // KK
+    0.653201, // AKo
+    0.573789, // A2s
+    0.582203, // A3s
+    0.590336, // A4s
+    0.599229, // A5s
+    0.599058, // A6s
+    0.609840, // A7s
+    0.619438, // A8s
+    0.627812, // A9s
+    0.646024, // ATs
+    0.653927, // AJs
+    0.662089, // AQs
+    0.670446, // AKs
+    0.852037, // AA
+};
+
+} // namespace PreflopEquityTable
@@ -1,19 +1,26 @@
 #include "../card.hpp"
+#include "../equity_cache.hpp"
+#include "../equity_calculator.hpp"
 #include "../player.hpp"
+#include "../poker_hand_evaluator.hpp"
+#include "../poker_hand_rank.hpp"
+#include "../preflop_equity.hpp"
 
 #include <gtest/gtest.h>
 
+#include <map>
+
 
 TEST(ComputerStrategyTest, flush_straight) {
     
     // All the cards and Round to determine the next move {call,fold, raise}
     ComputerPlayer p(Difficulty::Easy);
     
-    const Card *c1 = Card::get_card(Suit::Diamonds, Rank::Ace).get();
-    const Card *c2 = Card::get_card(Suit::Diamonds, Rank::King).get();
-    const Card *c3 = Card::get_card(Suit::Diamonds, Rank::Queen).get();
-    const Card *c4 = Card::get_card(Suit::Diamonds, Rank::Ten).get();
-    const Card *c5 = Card::get_card(Suit::Diamonds, Rank::Jack).get();
+    const Card *c1 = Card::get_card(Suit::Diamonds, Rank::Ace);
+    const Card *c2 = Card::get_card(Suit::Diamonds, Rank::King);
+    const Card *c3 = Card::get_card(Suit::Diamonds, Rank::Queen);
+    const Card *c4 = Card::get_card(Suit::Diamonds, Rank::Ten);
+    const Card *c5 = Card::get_card(Suit::Diamonds, Rank::Jack);
 
     std::vector<const Card*> cards = {c1,c2,c3,c4,c5};
     
@@ -83,11 +90,11 @@ TEST(ComputerStrategyTest, fourofkind){
     // All the cards and Round to determine the next move {call,fold, raise}
     ComputerPlayer p(Difficulty::Easy);
     
-    const Card *c1 = Card::get_card(Suit::Diamonds, Rank::Ace).get();
-    const Card *c2 = Card::get_card(Suit::Clubs, Rank::Ace).get();
-    const Card *c3 = Card::get_card(Suit::Hearts, Rank::Ace).get();
-    const Card *c4 = Card::get_card(Suit::Spades, Rank::Ace).get();
-    const Card *c5 = Card::get_card(Suit::Diamonds, Rank::Jack).get();
+    const Card *c1 = Card::get_card(Suit::Diamonds, Rank::Ace);
+    const Card *c2 = Card::get_card(Suit::Clubs, Rank::Ace);
+    const Card *c3 = Card::get_card(Suit::Hearts, Rank::Ace);
+    const Card *c4 = Card::get_card(Suit::Spades, Rank::Ace);
+    const Card *c5 = Card::get_card(Suit::Diamonds, Rank::Jack);
 
     std::vector<const Card*> cards = {c1,c2,c3,c4,c5};
     
@@ -151,6 +158,484 @@ TEST(ComputerStrategyTest, fourofkind){
 
 }
 
+TEST(ComputerStrategyTest, heads_up_equity_river) {
+    std::vector<const Card*> hole_cards = {
+        Card::get_card(Suit::Hearts, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::King),
+    };
+    std::vector<const Card*> community_cards = {
+        Card::get_card(Suit::Hearts, Rank::Queen),
+        Card::get_card(Suit::Hearts, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Ten),
+        Card::get_card(Suit::Clubs, Rank::Two),
+        Card::get_card(Suit::Diamonds, Rank::Three),
+    };
+
+    // Royal flush against all 45 * 44 / 2 opponent holdings.
+    EquityResult result = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EXPECT_EQ(result.wins, 990u);
+    EXPECT_EQ(result.showdowns(), 990u);
+    EXPECT_DOUBLE_EQ(result.equity(), 1.0);
+
+    // Only another ace and king (3 * 3 holdings) ties the broadway straight.
+    community_cards[0] = Card::get_card(Suit::Clubs, Rank::Queen);
+    result = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EXPECT_EQ(result.showdowns(), 990u);
+    EXPECT_EQ(result.losses, 0u);
+    EXPECT_EQ(result.ties, 9u);
+}
+
+TEST(ComputerStrategyTest, heads_up_equity_turn) {
+    std::vector<const Card*> hole_cards = {
+        Card::get_card(Suit::Spades, Rank::Eight),
+        Card::get_card(Suit::Spades, Rank::Seven),
+    };
+    std::vector<const Card*> community_cards = {
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Two),
+        Card::get_card(Suit::Clubs, Rank::King),
+    };
+
+    // Every river and opponent holding, however the work is split.
+    ThreadPool single_thread(1);
+    EquityResult serial = EquityCalculator::heads_up_equity(hole_cards, community_cards, single_thread);
+    EquityResult parallel = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EXPECT_EQ(serial.showdowns(), 46u * 990u);
+    EXPECT_EQ(parallel.wins, serial.wins);
+    EXPECT_EQ(parallel.ties, serial.ties);
+    EXPECT_EQ(parallel.losses, serial.losses);
+    EXPECT_GT(serial.equity(), 0.2);
+    EXPECT_LT(serial.equity(), 0.5);
+
+    EXPECT_THROW(EquityCalculator::heads_up_equity(hole_cards, {hole_cards[0]}), std::runtime_error);
+}
+
+TEST(ComputerStrategyTest, sampled_equity_is_reproducible) {
+    std::vector<const Card*> hole_cards = {
+        Card::get_card(Suit::Spades, Rank::Eight),
+        Card::get_card(Suit::Spades, Rank::Seven),
+    };
+    std::vector<const Card*> community_cards = {
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Two),
+        Card::get_card(Suit::Clubs, Rank::King),
+    };
+
+    // Same seed, same counts, whatever the number of threads.
+    ThreadPool single_thread(1);
+    ThreadPool four_threads(4);
+    EquityResult serial = EquityCalculator::sample_heads_up_equity(hole_cards, community_cards, 50000, 42, single_thread);
+    EquityResult parallel = EquityCalculator::sample_heads_up_equity(hole_cards, community_cards, 50000, 42, four_threads);
+    EXPECT_EQ(serial.showdowns(), 50000u);
+    EXPECT_EQ(parallel.wins, serial.wins);
+    EXPECT_EQ(parallel.ties, serial.ties);
+    EXPECT_EQ(parallel.losses, serial.losses);
+
+    EquityResult other_seed = EquityCalculator::sample_heads_up_equity(hole_cards, community_cards, 50000, 43, single_thread);
+    EXPECT_NE(other_seed.wins, serial.wins);
+
+    // Close to the exact equity.
+    EquityResult exact = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EXPECT_GT(serial.standard_error(), 0.0);
+    EXPECT_LT(serial.standard_error(), 0.005);
+    EXPECT_NEAR(serial.equity(), exact.equity(), 5 * serial.standard_error());
+}
+
+TEST(ComputerStrategyTest, sampled_equity_stops_at_target_or_deadline) {
+    std::vector<const Card*> hole_cards = {
+        Card::get_card(Suit::Hearts, Rank::Queen),
+        Card::get_card(Suit::Diamonds, Rank::Queen),
+    };
+    std::vector<const Card*> community_cards = {
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Two),
+    };
+    const auto no_deadline = std::chrono::steady_clock::time_point::max();
+
+    // Without a deadline, the samples only depend on the seed, not the pool size.
+    ThreadPool one_thread(1);
+    ThreadPool four_threads(4);
+    EquityResult result = EquityCalculator::sample_heads_up_equity_until(hole_cards, community_cards, no_deadline, 0.004, 7, one_thread);
+    EquityResult again = EquityCalculator::sample_heads_up_equity_until(hole_cards, community_cards, no_deadline, 0.004, 7, four_threads);
+    EXPECT_LE(result.standard_error(), 0.004);
+    EXPECT_GT(result.standard_error(), 0.002);
+    EXPECT_EQ(result.showdowns() % (8 * 1024), 0u);
+    EXPECT_EQ(again.wins, result.wins);
+    EXPECT_EQ(again.ties, result.ties);
+
+    EquityResult exact = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EXPECT_NEAR(result.equity(), exact.equity(), 5 * result.standard_error());
+
+    // A deadline already passed still gives one round of samples.
+    EquityResult rushed = EquityCalculator::sample_heads_up_equity_until(hole_cards, community_cards,
+                                                                          std::chrono::steady_clock::now(), 0.0, 7, four_threads);
+    EXPECT_EQ(rushed.showdowns(), 8 * 1024u);
+
+    auto start = std::chrono::steady_clock::now();
+    EquityResult timed = EquityCalculator::sample_heads_up_equity_until(hole_cards, community_cards,
+                                                                         start + std::chrono::milliseconds(20), 0.0, 7, four_threads);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    EXPECT_GT(timed.showdowns(), rushed.showdowns());
+
+    EXPECT_THROW(EquityCalculator::sample_heads_up_equity_until(hole_cards, community_cards, no_deadline, 0.0, 7),
+                 std::runtime_error);
+}
+
+TEST(ComputerStrategyTest, hand_potential_of_a_flush_draw) {
+    CardSet hole_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Spades, Rank::Eight),
+        Card::get_card(Suit::Spades, Rank::Seven),
+    });
+    CardSet community_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Two),
+        Card::get_card(Suit::Diamonds, Rank::King),
+    });
+
+    // Hand strength is the share of the pot won against each holding on the current board.
+    double won = 0.0;
+    std::size_t holdings = 0;
+    PokerHandRank rank = PokerHandRankEvaluator::evaluate(hole_cards | community_cards);
+    for (std::size_t i = 0; i < DECK_SIZE; i++) {
+        for (std::size_t j = i + 1; j < DECK_SIZE; j++) {
+            CardSet opponent_cards = CardSet::from_index(i) | CardSet::from_index(j);
+            if (!opponent_cards.intersects(hole_cards | community_cards)) {
+                PokerHandRank opponent_rank = PokerHandRankEvaluator::evaluate(opponent_cards | community_cards);
+                won += rank > opponent_rank ? 1.0 : rank == opponent_rank ? 0.5 : 0.0;
+                holdings++;
+            }
+        }
+    }
+
+    // Nine spades of the 44 rivers make the flush, and an eight or seven beats
+    // the weaker unpaired hands.
+    HandPotential potential = EquityCalculator::hand_potential(hole_cards, community_cards);
+    EXPECT_DOUBLE_EQ(potential.hand_strength, won / holdings);
+    EXPECT_GT(potential.positive_potential, 9.0 / 44);
+    EXPECT_LT(potential.positive_potential, 0.35);
+    EXPECT_LT(potential.negative_potential, 0.2);
+    EXPECT_DOUBLE_EQ(potential.effective_hand_strength(),
+                     potential.hand_strength * (1 - potential.negative_potential)
+                         + (1 - potential.hand_strength) * potential.positive_potential);
+
+    // Top set is ahead of every hand on the flop and can only lose ground.
+    CardSet flop = community_cards - CardSet::from_card(Card::get_card(Suit::Diamonds, Rank::King));
+    CardSet top_set(std::vector<const Card*>{
+        Card::get_card(Suit::Hearts, Rank::Ace),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
+    });
+    HandPotential top_set_potential = EquityCalculator::hand_potential(top_set, flop, 2);
+    EXPECT_DOUBLE_EQ(top_set_potential.hand_strength, 1.0);
+    EXPECT_EQ(top_set_potential.positive_potential, 0.0);
+    EXPECT_GT(top_set_potential.negative_potential, 0.0);
+
+    EXPECT_THROW(EquityCalculator::hand_potential(hole_cards, community_cards, 2), std::runtime_error);
+    EXPECT_THROW(EquityCalculator::hand_potential(hole_cards, CardSet()), std::runtime_error);
+}
+
+TEST(ComputerStrategyTest, multiway_equity_splits_pots) {
+    auto cards = [](std::initializer_list<std::pair<Suit, Rank>> list) {
+        CardSet set;
+        for (auto [suit, rank] : list) {
+            set.add(Card::get_card(suit, rank));
+        }
+        return set;
+    };
+    std::vector<CardSet> hole_cards = {
+        cards({{Suit::Clubs, Rank::Ace}, {Suit::Clubs, Rank::Three}}),
+        cards({{Suit::Diamonds, Rank::Ace}, {Suit::Spades, Rank::Four}}),
+        cards({{Suit::Hearts, Rank::Seven}, {Suit::Hearts, Rank::Eight}}),
+    };
+    CardSet community_cards = cards({{Suit::Clubs, Rank::Ten}, {Suit::Hearts, Rank::Jack},
+                                     {Suit::Diamonds, Rank::Queen}, {Suit::Spades, Rank::King}});
+
+    // Every river checked against determine_winners.
+    MultiwayEquityResult expected(hole_cards.size());
+    for (std::size_t index = 0; index < DECK_SIZE; index++) {
+        CardSet river = CardSet::from_index(index);
+        if (river.intersects(community_cards | hole_cards[0] | hole_cards[1] | hole_cards[2])) {
+            continue;
+        }
+        PokerShowdownResult showdown = PokerHandEvaluator::determine_winners(hole_cards, community_cards | river);
+        for (std::size_t winner : showdown.winners) {
+            (showdown.winners.size() == 1 ? expected.wins : expected.ties)[winner]++;
+            expected.shares[winner] += MultiwayEquityResult::SHARE_UNITS / showdown.winners.size();
+        }
+        expected.showdowns++;
+    }
+
+    MultiwayEquityResult result = EquityCalculator::multiway_equity(hole_cards, community_cards);
+    EXPECT_EQ(result.showdowns, 42u);
+    EXPECT_EQ(result.wins, expected.wins);
+    EXPECT_EQ(result.ties, expected.ties);
+    EXPECT_EQ(result.shares, expected.shares);
+    EXPECT_GT(result.ties[0], 0u);
+    EXPECT_DOUBLE_EQ(result.equity(0) + result.equity(1) + result.equity(2), 1.0);
+
+    EXPECT_THROW(EquityCalculator::multiway_equity({hole_cards[0]}, community_cards), std::runtime_error);
+    EXPECT_THROW(EquityCalculator::multiway_equity({hole_cards[0], hole_cards[0]}, community_cards), std::runtime_error);
+    EXPECT_THROW(EquityCalculator::multiway_equity({hole_cards[0], CardSet()}, community_cards), std::runtime_error);
+}
+
+TEST(ComputerStrategyTest, sampled_multiway_equity) {
+    CardSet aces(std::vector<const Card*>{
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Ace),
+    });
+    std::vector<CardSet> hole_cards = {aces, CardSet(), CardSet()};
+
+    // Same counts whatever the number of threads.
+    ThreadPool single_thread(1);
+    ThreadPool four_threads(4);
+    MultiwayEquityResult serial = EquityCalculator::sample_multiway_equity(hole_cards, CardSet(), 100000, 42, single_thread);
+    MultiwayEquityResult parallel = EquityCalculator::sample_multiway_equity(hole_cards, CardSet(), 100000, 42, four_threads);
+    EXPECT_EQ(serial.showdowns, 100000u);
+    EXPECT_EQ(serial.shares, parallel.shares);
+
+    // Pocket aces win about 73.4% against two random hands, which split the rest.
+    EXPECT_NEAR(serial.equity(0), 0.734, 0.006);
+    EXPECT_NEAR(serial.equity(1), serial.equity(2), 0.006);
+
+    // Nine random opponents.
+    hole_cards.resize(10);
+    MultiwayEquityResult full_ring = EquityCalculator::sample_multiway_equity(hole_cards, CardSet(), 100000, 42);
+    EXPECT_NEAR(full_ring.equity(0), 0.312, 0.006);
+}
+
+TEST(ComputerStrategyTest, hand_range_parsing) {
+    EXPECT_EQ(HandRange("AA").combo_count(), 6u);
+    EXPECT_EQ(HandRange("AKs").combo_count(), 4u);
+    EXPECT_EQ(HandRange("AKo").combo_count(), 12u);
+    EXPECT_EQ(HandRange("QQ+, AKs").combo_count(), 22u);
+    EXPECT_EQ(HandRange("ATs+").combo_count(), 16u);
+    EXPECT_EQ(HandRange("22+, A2s+").combo_count(), 78u + 48u);
+    EXPECT_EQ(HandRange("22-44").combo_count(), 18u);
+    EXPECT_EQ(HandRange("A2s-A5s"), HandRange("A5s, A4s, A3s, A2s"));
+    EXPECT_EQ(HandRange("QQ+"), HandRange("AA,KK,QQ"));
+
+    std::size_t ace_king = HandRange::combo_index(Card::get_card(Suit::Hearts, Rank::Ace)->get_index(),
+                                                  Card::get_card(Suit::Hearts, Rank::King)->get_index());
+    HandRange weighted("AhKh:0.25, KK");
+    EXPECT_EQ(weighted.combo_count(), 7u);
+    EXPECT_DOUBLE_EQ(weighted.weight(ace_king), 0.25);
+    EXPECT_EQ(HandRange::combo_cards(ace_king), CardSet(std::vector<const Card*>{
+        Card::get_card(Suit::Hearts, Rank::Ace), Card::get_card(Suit::Hearts, Rank::King)}));
+
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        CardSet cards = HandRange::combo_cards(combo);
+        ASSERT_EQ(cards.count(), 2u);
+        std::size_t first = cards.first_index();
+        EXPECT_EQ(HandRange::combo_index((cards - CardSet::from_index(first)).first_index(), first), combo);
+    }
+
+    EXPECT_THROW(HandRange("AAs"), std::runtime_error);
+    EXPECT_THROW(HandRange("AX"), std::runtime_error);
+    EXPECT_THROW(HandRange("AK-QJ"), std::runtime_error);
+    EXPECT_THROW(HandRange("AhAh"), std::runtime_error);
+    EXPECT_THROW(HandRange("AK:x"), std::runtime_error);
+}
+
+TEST(ComputerStrategyTest, range_equity_matches_heads_up_equity) {
+    std::vector<const Card*> hole_cards = {
+        Card::get_card(Suit::Spades, Rank::Eight),
+        Card::get_card(Suit::Spades, Rank::Seven),
+    };
+    std::vector<const Card*> community_cards = {
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Two),
+    };
+
+    // One combo against every hand is the heads-up equity against a random hand.
+    HandRange hand("8s7s");
+    HandRange any_hand;
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        any_hand.set_weight(combo, 1.0);
+    }
+
+    RangeEquityResult range_result = EquityCalculator::range_equity(hand, any_hand, CardSet(community_cards));
+    EquityResult result = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EXPECT_DOUBLE_EQ(range_result.wins, result.wins);
+    EXPECT_DOUBLE_EQ(range_result.ties, result.ties);
+    EXPECT_DOUBLE_EQ(range_result.losses, result.losses);
+
+    // Symmetric ranges split evenly, and conflicting combos are left out.
+    HandRange range("QQ+, AKs, ATs+");
+    RangeEquityResult even = EquityCalculator::range_equity(range, range, CardSet(community_cards));
+    EXPECT_DOUBLE_EQ(even.wins, even.losses);
+    EXPECT_NEAR(even.equity(), 0.5, 1e-12);
+
+    RangeEquityResult blocked = EquityCalculator::range_equity(HandRange("AsKs"), HandRange("AsKs, 2s2h"), CardSet(community_cards));
+    EXPECT_EQ(blocked.showdowns(), 0.0);
+}
+
+TEST(ComputerStrategyTest, combo_equity_matches_heads_up_equity) {
+    std::vector<const Card*> community_cards = {
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Two),
+        Card::get_card(Suit::Diamonds, Rank::Nine),
+    };
+    HandRange any_hand;
+    for (std::size_t combo = 0; combo < HandRange::COMBO_COUNT; combo++) {
+        any_hand.set_weight(combo, 1.0);
+    }
+
+    // Every combo, not only the smallest of its suit orbit, gets its own results.
+    std::vector<RangeEquityResult> results = EquityCalculator::combo_equity(any_hand, any_hand, CardSet(community_cards));
+    for (auto [suit1, suit2] : {std::pair{Suit::Clubs, Suit::Clubs}, {Suit::Spades, Suit::Spades}, {Suit::Hearts, Suit::Clubs}}) {
+        std::vector<const Card*> hole_cards = {Card::get_card(suit1, Rank::Eight), Card::get_card(suit2, Rank::Seven)};
+        EquityResult expected = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+        const RangeEquityResult& result = results[HandRange::combo_index(hole_cards[0]->get_index(), hole_cards[1]->get_index())];
+        EXPECT_NEAR(result.wins, expected.wins, 1e-6);
+        EXPECT_NEAR(result.ties, expected.ties, 1e-6);
+        EXPECT_NEAR(result.losses, expected.losses, 1e-6);
+    }
+
+    // Combos using a community card have no showdowns.
+    std::size_t blocked = HandRange::combo_index(community_cards[0]->get_index(), community_cards[1]->get_index());
+    EXPECT_EQ(results[blocked].showdowns(), 0.0);
+}
+
+TEST(ComputerStrategyTest, preflop_equity_table) {
+    const Card* ace_spades = Card::get_card(Suit::Spades, Rank::Ace);
+    const Card* ace_hearts = Card::get_card(Suit::Hearts, Rank::Ace);
+    const Card* king_spades = Card::get_card(Suit::Spades, Rank::King);
+    const Card* king_hearts = Card::get_card(Suit::Hearts, Rank::King);
+    const Card* seven_clubs = Card::get_card(Suit::Clubs, Rank::Seven);
+    const Card* two_hearts = Card::get_card(Suit::Hearts, Rank::Two);
+
+    EXPECT_EQ(PreflopEquity::class_name(PreflopEquity::class_index(ace_spades, ace_hearts)), "AA");
+    EXPECT_EQ(PreflopEquity::class_name(PreflopEquity::class_index(king_spades, ace_spades)), "AKs");
+    EXPECT_EQ(PreflopEquity::class_name(PreflopEquity::class_index(ace_spades, king_hearts)), "AKo");
+    EXPECT_EQ(PreflopEquity::class_name(PreflopEquity::class_index(two_hearts, seven_clubs)), "72o");
+    EXPECT_THROW(PreflopEquity::class_name(PreflopEquity::CLASS_COUNT), std::runtime_error);
+
+    // Well known all-in equities against a random hand.
+    EXPECT_NEAR(PreflopEquity::equity(ace_spades, ace_hearts), 0.8520, 1e-4);
+    EXPECT_NEAR(PreflopEquity::equity(ace_spades, king_spades), 0.6704, 1e-4);
+    EXPECT_NEAR(PreflopEquity::equity(ace_spades, king_hearts), 0.6532, 1e-4);
+    EXPECT_NEAR(PreflopEquity::equity(seven_clubs, two_hearts), 0.3458, 1e-4);
+
+    EXPECT_EQ(PreflopEquity::strength(ace_spades, ace_hearts), 100);
+    EXPECT_GT(PreflopEquity::strength(ace_spades, king_spades), PreflopEquity::strength(ace_spades, king_hearts));
+    EXPECT_LT(PreflopEquity::strength(seven_clubs, two_hearts), 10);
+}
+
+TEST(ComputerStrategyTest, equity_cache_shares_suit_permutations) {
+    EquityCache cache(2);
+    CardSet hole_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Hearts, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::King),
+    });
+    CardSet community_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Hearts, Rank::Two),
+        Card::get_card(Suit::Spades, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Diamonds, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Nine),
+    });
+    // Hearts and spades swapped.
+    CardSet swapped_hole_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Spades, Rank::King),
+    });
+    CardSet swapped_community_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Spades, Rank::Two),
+        Card::get_card(Suit::Hearts, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Diamonds, Rank::Jack),
+        Card::get_card(Suit::Spades, Rank::Nine),
+    });
+
+    EquityResult expected = EquityCalculator::heads_up_equity(hole_cards, community_cards);
+    EquityResult result = cache.heads_up_equity(hole_cards, community_cards);
+    EXPECT_EQ(result.wins, expected.wins);
+    EXPECT_EQ(result.ties, expected.ties);
+    EXPECT_EQ(result.losses, expected.losses);
+    EXPECT_EQ(cache.misses(), 1u);
+
+    EXPECT_EQ(cache.heads_up_equity(swapped_hole_cards, swapped_community_cards).wins, expected.wins);
+    EXPECT_EQ(cache.hits(), 1u);
+    EXPECT_EQ(cache.size(), 1u);
+
+    // The least recently used entry is dropped.
+    CardSet turn = community_cards - CardSet::from_card(Card::get_card(Suit::Hearts, Rank::Nine));
+    CardSet river = (community_cards - CardSet::from_card(Card::get_card(Suit::Hearts, Rank::Two)))
+                  | CardSet::from_card(Card::get_card(Suit::Clubs, Rank::Two));
+    cache.heads_up_equity(hole_cards, turn);
+    cache.heads_up_equity(hole_cards, community_cards);
+    cache.heads_up_equity(hole_cards, river);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_TRUE(cache.find(hole_cards, community_cards).has_value());
+    EXPECT_FALSE(cache.find(hole_cards, turn).has_value());
+    EXPECT_EQ(cache.hits(), 3u);
+    EXPECT_EQ(cache.misses(), 4u);
+
+    EXPECT_THROW(cache.heads_up_equity(hole_cards, hole_cards), std::runtime_error);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+    EXPECT_EQ(cache.hits(), 0u);
+}
+
+TEST(ComputerStrategyTest, equity_cache_keeps_hand_potentials_apart) {
+    EquityCache cache;
+    CardSet hole_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Hearts, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::King),
+    });
+    CardSet community_cards(std::vector<const Card*>{
+        Card::get_card(Suit::Hearts, Rank::Two),
+        Card::get_card(Suit::Hearts, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Diamonds, Rank::Nine),
+    });
+
+    HandPotential expected = EquityCalculator::hand_potential(hole_cards, community_cards);
+    HandPotential potential = cache.hand_potential(hole_cards, community_cards);
+    EXPECT_DOUBLE_EQ(potential.hand_strength, expected.hand_strength);
+    EXPECT_DOUBLE_EQ(potential.positive_potential, expected.positive_potential);
+    EXPECT_DOUBLE_EQ(potential.negative_potential, expected.negative_potential);
+    EXPECT_FALSE(cache.find(hole_cards, community_cards).has_value());
+
+    cache.heads_up_equity(hole_cards, community_cards);
+    EXPECT_DOUBLE_EQ(cache.hand_potential(hole_cards, community_cards).positive_potential,
+                     expected.positive_potential);
+    EXPECT_EQ(cache.size(), 2u);
+    EXPECT_EQ(cache.hits(), 1u);
+}
+
+TEST(ComputerStrategyTest, hard_strategy_raises_the_nuts) {
+    ComputerPlayer p(Difficulty::Hard);
+
+    GameState state{};
+    state.hands = {
+        Card::get_card(Suit::Hearts, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::King),
+    };
+    state.community_cards = {
+        Card::get_card(Suit::Hearts, Rank::Queen),
+        Card::get_card(Suit::Hearts, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Ten),
+        Card::get_card(Suit::Clubs, Rank::Two),
+    };
+    state.stage = PokerEngineEnumState::Turn;
+    state.current_bet = 20;
+    state.pot_size = 100;
+    state.computer_chips = 1000;
+
+    EXPECT_TRUE(std::holds_alternative<Raise>(p.get_move(state)));
+
+    // Before the flop it calls without enumerating.
+    state.community_cards.clear();
+    state.stage = PokerEngineEnumState::PreFlop;
+    EXPECT_TRUE(std::holds_alternative<Call>(p.get_move(state)));
+}
 
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
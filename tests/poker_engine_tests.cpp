@@ -1,7 +1,13 @@
+#include "../card_set.hpp"
+#include "../deck.hpp"
 #include "../poker_engine.hpp"
+#include "../poker_simulator.hpp"
 
 #include <gtest/gtest.h>
 
+#include <mutex>
+#include <thread>
+
 class PokerEngineTests : public ::testing::Test {
 public:
     PokerEngineTests()
@@ -400,11 +406,31 @@ TEST_F(PokerEngineTests, CallShowdown) {
     EXPECT_TRUE(enum_state() == PokerEngineEnumState::Showdown);
 }
 
+TEST_F(PokerEngineTests, WinningHandAfterShowdown) {
+    advance_to_showdown();
+
+    std::optional<PokerHand> winning_hand = game.get_winning_hand();
+    if (game.get_winner() == PokerHandWinner::Tie) {
+        EXPECT_FALSE(winning_hand.has_value());
+        return;
+    }
+
+    ASSERT_TRUE(winning_hand.has_value());
+    const std::vector<const Card*>& hand = game.get_winner() == PokerHandWinner::Player1
+        ? game.get_human_player().hand : game.get_computer_player().hand;
+    CardSet cards = CardSet(winning_hand.value().get_cards());
+    EXPECT_EQ(cards.count(), POKER_HAND_SIZE);
+    EXPECT_TRUE((cards - CardSet(hand) - CardSet(game.get_community_cards())).empty());
+    EXPECT_EQ(PokerHandRankEvaluator::evaluate(cards), PokerHandRankEvaluator::evaluate(hand, game.get_community_cards()));
+    EXPECT_EQ(game.get_winning_hand_description(), PokerHandRankEvaluator::evaluation(PokerHandRankEvaluator::evaluate(cards)).to_string());
+}
+
 TEST_F(PokerEngineTests, NewGameAfterFolded) {
     GameAction::Result result = engine.make_move(PlayerType::Human, Fold{});
     EXPECT_TRUE(result.ok);
     EXPECT_TRUE(enum_state() == PokerEngineEnumState::Folded);
     EXPECT_TRUE(game.has_ended());
+    EXPECT_FALSE(game.get_winning_hand().has_value());
 
     result = engine.new_game();
     EXPECT_TRUE(result.ok);
@@ -426,6 +452,89 @@ TEST_F(PokerEngineTests, NewGameAfterShowdown) {
     EXPECT_EQ(game.get_computer_player().current_bet, 0);
 }
 
+TEST(DeckTests, SeededDecksDealTheSameCards) {
+    Deck deck(Xoshiro256(7));
+    Deck same_seed(Xoshiro256(3));
+    same_seed.deal_card();
+    same_seed.seed(7);
+
+    CardSet dealt;
+    while (!deck.is_empty()) {
+        const Card* card = deck.deal_card();
+        EXPECT_EQ(card, same_seed.deal_card());
+        EXPECT_FALSE(dealt.contains(card));
+        dealt |= CardSet::from_card(card);
+    }
+    EXPECT_EQ(dealt, CardSet::full_deck());
+    EXPECT_TRUE(same_seed.is_empty());
+    EXPECT_THROW(deck.deal_card(), std::runtime_error);
+
+    deck.shuffle();
+    EXPECT_FALSE(deck.is_empty());
+}
+
+TEST(DeckTests, SeededGamesDealTheSameHands) {
+    PokerGame game;
+    PokerGame same_seed;
+    game.seed_deck(11);
+    same_seed.seed_deck(11);
+
+    for (int hand = 0; hand < 3; hand++) {
+        for (PokerGame* g : {&game, &same_seed}) {
+            g->shuffle_deck();
+            g->deal_hole_cards();
+            g->deal_flop();
+            g->deal_turn();
+            g->deal_river();
+        }
+        EXPECT_EQ(game.get_human_player().hand, same_seed.get_human_player().hand);
+        EXPECT_EQ(game.get_computer_player().hand, same_seed.get_computer_player().hand);
+        EXPECT_EQ(game.get_community_cards(), same_seed.get_community_cards());
+    }
+}
+
+TEST(PokerSimulatorTests, PlaysHandsBetweenComputerPlayers) {
+    PokerSimulator simulator(Difficulty::Easy, Difficulty::Medium);
+    SimulationResult result = simulator.run(200);
+
+    EXPECT_EQ(result.hands, 200);
+    EXPECT_EQ(result.wins[0] + result.wins[1] + result.ties, result.hands);
+    EXPECT_LE(result.showdowns, result.hands);
+    EXPECT_GT(result.streets[0].actions, result.hands);
+    EXPECT_GE(result.average_pot(), 15.0);
+    EXPECT_TRUE(simulator.get_game().has_ended());
+
+    // Chips only change hands, apart from the odd chip of a split pot.
+    EXPECT_LE(result.net_chips[0] + result.net_chips[1], 0);
+    EXPECT_GE(result.net_chips[0] + result.net_chips[1], -static_cast<std::int64_t>(result.ties));
+}
+
+TEST(PokerSimulatorTests, MergesTablesPlayedInParallel) {
+    MultiTableSimulator simulator(Difficulty::Easy, Difficulty::Easy, 8);
+    ASSERT_EQ(simulator.table_count(), 8);
+
+    SimulationResult result = simulator.run(1003);
+    EXPECT_EQ(result.hands, 1003);
+    EXPECT_EQ(result.wins[0] + result.wins[1] + result.ties, result.hands);
+    EXPECT_EQ(result.showdowns, result.hands);
+    EXPECT_LE(result.net_chips[0] + result.net_chips[1], 0);
+    EXPECT_GE(result.net_chips[0] + result.net_chips[1], -static_cast<std::int64_t>(result.ties));
+}
+
+TEST(PokerSimulatorTests, NestedParallelLoopsRunInline) {
+    ThreadPool tables(4);
+    std::mutex mutex;
+    bool inline_loops = true;
+    tables.parallel_for(16, [&](std::size_t, std::size_t) {
+        std::thread::id table_thread = std::this_thread::get_id();
+        ThreadPool::shared().parallel_for(64, [&](std::size_t, std::size_t) {
+            std::lock_guard<std::mutex> lock(mutex);
+            inline_loops = inline_loops && std::this_thread::get_id() == table_thread;
+        });
+    });
+    EXPECT_TRUE(inline_loops);
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,121 @@
+#include "../card_set.hpp"
+#include "../poker_hand_evaluator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> allocation_count{0};
+
+} // namespace
+
+// Count every allocation of the process.
+void* operator new(std::size_t size) {
+    allocation_count++;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+class PokerHandAllocationTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        player1_cards = {
+            Card::get_card(Suit::Hearts, Rank::Ace),
+            Card::get_card(Suit::Hearts, Rank::King),
+        };
+        player2_cards = {
+            Card::get_card(Suit::Clubs, Rank::Queen),
+            Card::get_card(Suit::Spades, Rank::Queen),
+        };
+        community_cards = {
+            Card::get_card(Suit::Hearts, Rank::Queen),
+            Card::get_card(Suit::Hearts, Rank::Jack),
+            Card::get_card(Suit::Diamonds, Rank::Two),
+            Card::get_card(Suit::Hearts, Rank::Five),
+            Card::get_card(Suit::Diamonds, Rank::Queen),
+        };
+
+        // Fill the lazily built tables beforehand.
+        PokerHandEvaluator::determine_winner(player1_cards, player2_cards, community_cards);
+    }
+
+    // Number of allocations made by f.
+    template <typename F>
+    std::size_t count_allocations(F f) {
+        std::size_t before = allocation_count;
+        f();
+        return allocation_count - before;
+    }
+
+    std::vector<const Card*> player1_cards;
+    std::vector<const Card*> player2_cards;
+    std::vector<const Card*> community_cards;
+};
+
+TEST_F(PokerHandAllocationTests, EvaluateHandDoesNotAllocate) {
+    EXPECT_EQ(count_allocations([&] {
+        auto [poker_hand, evaluation] = PokerHandEvaluator::evaluate_hand(player1_cards, community_cards);
+        EXPECT_EQ(evaluation.category, PokerHandEvaluationCategory::Flush);
+    }), 0u);
+
+    EXPECT_EQ(count_allocations([&] {
+        auto [poker_hand, evaluation] = PokerHandEvaluator::evaluate_hand(CardSet(player2_cards), CardSet(community_cards));
+        EXPECT_EQ(evaluation.category, PokerHandEvaluationCategory::FourOfAKind);
+    }), 0u);
+}
+
+TEST_F(PokerHandAllocationTests, DetermineWinnerDoesNotAllocate) {
+    EXPECT_EQ(count_allocations([&] {
+        PokerHandResult result = PokerHandEvaluator::determine_winner(player1_cards, player2_cards, community_cards);
+        EXPECT_EQ(result.winner, PokerHandWinner::Player2);
+    }), 0u);
+
+    EXPECT_EQ(count_allocations([&] {
+        PokerHandResult result = PokerHandEvaluator::determine_winner(
+            CardSet(player1_cards), CardSet(player2_cards), CardSet(community_cards));
+        EXPECT_EQ(result.winner, PokerHandWinner::Player2);
+    }), 0u);
+}
+
+TEST_F(PokerHandAllocationTests, CardLookupDoesNotAllocate) {
+    EXPECT_EQ(count_allocations([&] {
+        for (std::size_t index = 0; index < DECK_SIZE; index++) {
+            const Card* card = Card::get_card(index);
+            EXPECT_EQ(card, Card::get_card(card->get_suit(), card->get_rank()));
+            EXPECT_EQ(card->get_index(), index);
+        }
+    }), 0u);
+
+    static_assert(Card::get_card(Suit::Spades, Rank::Ace)->get_index() == DECK_SIZE - 1);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,26 +1,39 @@
+#include "../board_texture.hpp"
+#include "../hand_indexer.hpp"
+#include "../hand_range.hpp"
 #include "../poker_hand_evaluator.hpp"
+#include "../poker_hand_rank.hpp"
+#include "../poker_hand_rank_file.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+
 class PokerHandEvaluatorTests : public ::testing::Test {};
 
 TEST(PokerHandEvaluatorTests, RoyalFlush) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Ace).get(),
-        Card::get_card(Suit::Clubs, Rank::King).get(),
+        Card::get_card(Suit::Clubs, Rank::Ace),
+        Card::get_card(Suit::Clubs, Rank::King),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Clubs, Rank::Jack).get(),
-        Card::get_card(Suit::Clubs, Rank::Ten).get(),
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Clubs, Rank::Eight).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Clubs, Rank::Ten),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Clubs, Rank::Eight),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -28,26 +41,26 @@ TEST(PokerHandEvaluatorTests, RoyalFlush) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::StraightFlush);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Ace);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Ace);
 }
 
 TEST(PokerHandEvaluatorTests, FourOfAKind) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Ace).get(),
-        Card::get_card(Suit::Hearts, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Ace),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Clubs, Rank::Jack).get(),
-        Card::get_card(Suit::Spades, Rank::Ace).get(),
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -55,27 +68,27 @@ TEST(PokerHandEvaluatorTests, FourOfAKind) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::FourOfAKind);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Ace);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::Queen);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Ace);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::Queen);
 }
 
 TEST(PokerHandEvaluatorTests, FullHouseTripletHighCard) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Ace).get(),
-        Card::get_card(Suit::Hearts, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Ace),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Ten).get(),
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Ten),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -83,27 +96,27 @@ TEST(PokerHandEvaluatorTests, FullHouseTripletHighCard) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player2);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::FullHouse);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Ace);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::Queen);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Ace);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::Queen);
 }
 
 TEST(PokerHandEvaluatorTests, FullHousePairHighCard) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Ace).get(),
-        Card::get_card(Suit::Hearts, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Ace),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Ten).get(),
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Queen).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Ten),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Queen),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -111,27 +124,27 @@ TEST(PokerHandEvaluatorTests, FullHousePairHighCard) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player2);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::FullHouse);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Queen);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::Ace);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Queen);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::Ace);
 }
 
 TEST(PokerHandEvaluatorTests, Flush) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Ace).get(),
-        Card::get_card(Suit::Hearts, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Ace),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Hearts, Rank::Queen).get(),
-        Card::get_card(Suit::Hearts, Rank::Jack).get(),
-        Card::get_card(Suit::Hearts, Rank::Ten).get(),
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Queen).get(),
+        Card::get_card(Suit::Hearts, Rank::Queen),
+        Card::get_card(Suit::Hearts, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Ten),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Queen),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -139,26 +152,26 @@ TEST(PokerHandEvaluatorTests, Flush) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::Flush);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Queen);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Queen);
 }
 
 TEST(PokerHandEvaluatorTests, FlushBothHighCardKicker) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Jack).get(),
-        Card::get_card(Suit::Hearts, Rank::Ten).get(),
+        Card::get_card(Suit::Hearts, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Ten),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Queen).get(),
-        Card::get_card(Suit::Hearts, Rank::Three).get(),
+        Card::get_card(Suit::Hearts, Rank::Queen),
+        Card::get_card(Suit::Hearts, Rank::Three),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Hearts, Rank::Two).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
-        Card::get_card(Suit::Hearts, Rank::Seven).get(),
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Queen).get(),
+        Card::get_card(Suit::Hearts, Rank::Two),
+        Card::get_card(Suit::Hearts, Rank::Four),
+        Card::get_card(Suit::Hearts, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Queen),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -166,26 +179,26 @@ TEST(PokerHandEvaluatorTests, FlushBothHighCardKicker) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player2);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::Flush);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Queen);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Queen);
 }
 
 TEST(PokerHandEvaluatorTests, Straight) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Six).get(),
-        Card::get_card(Suit::Spades, Rank::Three).get(),
+        Card::get_card(Suit::Clubs, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Three),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Jack).get(),
-        Card::get_card(Suit::Hearts, Rank::Three).get(),
-        Card::get_card(Suit::Clubs, Rank::Two).get(),
-        Card::get_card(Suit::Diamonds, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Three),
+        Card::get_card(Suit::Clubs, Rank::Two),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -193,26 +206,26 @@ TEST(PokerHandEvaluatorTests, Straight) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::Straight);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Five);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Five);
 }
 
 TEST(PokerHandEvaluatorTests, StraightBothHighCardKicker) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Six).get(),
-        Card::get_card(Suit::Spades, Rank::Five).get(),
+        Card::get_card(Suit::Clubs, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Five),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Four).get(),
-        Card::get_card(Suit::Hearts, Rank::Three).get(),
-        Card::get_card(Suit::Clubs, Rank::Two).get(),
-        Card::get_card(Suit::Diamonds, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Four),
+        Card::get_card(Suit::Hearts, Rank::Three),
+        Card::get_card(Suit::Clubs, Rank::Two),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -220,26 +233,26 @@ TEST(PokerHandEvaluatorTests, StraightBothHighCardKicker) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player2);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::Straight);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Six);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Six);
 }
 
 TEST(PokerHandEvaluatorTests, ThreeOfAKind) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Six).get(),
-        Card::get_card(Suit::Spades, Rank::Five).get(),
+        Card::get_card(Suit::Clubs, Rank::Six),
+        Card::get_card(Suit::Spades, Rank::Five),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Four).get(),
-        Card::get_card(Suit::Clubs, Rank::Four).get(),
-        Card::get_card(Suit::Clubs, Rank::Jack).get(),
-        Card::get_card(Suit::Diamonds, Rank::Ace).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Four),
+        Card::get_card(Suit::Clubs, Rank::Four),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -247,27 +260,27 @@ TEST(PokerHandEvaluatorTests, ThreeOfAKind) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::ThreeOfAKind);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Four);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::Ace);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Four);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::Ace);
 }
 
 TEST(PokerHandEvaluatorTests, ThreeOfAKindBothHighCardKicker) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Four).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Four),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Four).get(),
-        Card::get_card(Suit::Clubs, Rank::Four).get(),
-        Card::get_card(Suit::Clubs, Rank::Three).get(),
-        Card::get_card(Suit::Diamonds, Rank::Two).get(),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Four),
+        Card::get_card(Suit::Clubs, Rank::Four),
+        Card::get_card(Suit::Clubs, Rank::Three),
+        Card::get_card(Suit::Diamonds, Rank::Two),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -275,27 +288,27 @@ TEST(PokerHandEvaluatorTests, ThreeOfAKindBothHighCardKicker) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player2);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::ThreeOfAKind);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Four);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::Queen);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Four);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::Queen);
 }
 
 TEST(PokerHandEvaluatorTests, TwoPair) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::Four).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::Four),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Three).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Three),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Five).get(),
-        Card::get_card(Suit::Diamonds, Rank::Four).get(),
-        Card::get_card(Suit::Clubs, Rank::Jack).get(),
-        Card::get_card(Suit::Clubs, Rank::Three).get(),
-        Card::get_card(Suit::Diamonds, Rank::Two).get(),
+        Card::get_card(Suit::Clubs, Rank::Five),
+        Card::get_card(Suit::Diamonds, Rank::Four),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Clubs, Rank::Three),
+        Card::get_card(Suit::Diamonds, Rank::Two),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -303,27 +316,27 @@ TEST(PokerHandEvaluatorTests, TwoPair) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::TwoPair);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Five);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::Four);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Five);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::Four);
 }
 
 TEST(PokerHandEvaluatorTests, OnePair) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::King).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::King),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Eight).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Eight),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Five).get(),
-        Card::get_card(Suit::Diamonds, Rank::Seven).get(),
-        Card::get_card(Suit::Clubs, Rank::Jack).get(),
-        Card::get_card(Suit::Clubs, Rank::Three).get(),
-        Card::get_card(Suit::Diamonds, Rank::Two).get(),
+        Card::get_card(Suit::Clubs, Rank::Five),
+        Card::get_card(Suit::Diamonds, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Clubs, Rank::Three),
+        Card::get_card(Suit::Diamonds, Rank::Two),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -331,27 +344,27 @@ TEST(PokerHandEvaluatorTests, OnePair) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::OnePair);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::Five);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[1], (int)Rank::King);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Five);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(1), (int)Rank::King);
 }
 
 TEST(PokerHandEvaluatorTests, HighCard) {
     std::vector<const Card*> player1_hole_cards {
-        Card::get_card(Suit::Hearts, Rank::Five).get(),
-        Card::get_card(Suit::Hearts, Rank::King).get(),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Hearts, Rank::King),
     };
 
     std::vector<const Card*> player2_hole_cards {
-        Card::get_card(Suit::Clubs, Rank::Queen).get(),
-        Card::get_card(Suit::Spades, Rank::Eight).get(),
+        Card::get_card(Suit::Clubs, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::Eight),
     };
 
     std::vector<const Card*> community_cards {
-        Card::get_card(Suit::Clubs, Rank::Nine).get(),
-        Card::get_card(Suit::Diamonds, Rank::Seven).get(),
-        Card::get_card(Suit::Clubs, Rank::Jack).get(),
-        Card::get_card(Suit::Clubs, Rank::Three).get(),
-        Card::get_card(Suit::Diamonds, Rank::Two).get(),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Jack),
+        Card::get_card(Suit::Clubs, Rank::Three),
+        Card::get_card(Suit::Diamonds, Rank::Two),
     };
 
     PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
@@ -359,7 +372,428 @@ TEST(PokerHandEvaluatorTests, HighCard) {
 
     EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player1);
     EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::HighCard);
-    EXPECT_EQ(poker_hand_result.evaluation.tiebreakers[0], (int)Rank::King);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::King);
+}
+
+TEST(PokerHandEvaluatorTests, RankAllFiveCardHands) {
+    std::vector<const Card*> deck;
+    for (Suit suit : suits) {
+        for (Rank rank : ranks) {
+            deck.push_back(Card::get_card(suit, rank));
+        }
+    }
+
+    std::map<PokerHandEvaluationCategory, int> category_counts;
+    std::set<PokerHandRank> distinct_ranks;
+    std::vector<const Card*> cards(POKER_HAND_SIZE);
+
+    for (int a = 0; a < 52; a++)
+    for (int b = a + 1; b < 52; b++)
+    for (int c = b + 1; c < 52; c++)
+    for (int d = c + 1; d < 52; d++)
+    for (int e = d + 1; e < 52; e++) {
+        cards = {deck[a], deck[b], deck[c], deck[d], deck[e]};
+        PokerHandRank rank = PokerHandRankEvaluator::evaluate(cards);
+        category_counts[PokerHandRankEvaluator::category(rank)]++;
+        distinct_ranks.insert(rank);
+    }
+
+    EXPECT_EQ(distinct_ranks.size(), POKER_HAND_RANK_COUNT);
+    EXPECT_EQ(*distinct_ranks.begin(), 1);
+    EXPECT_EQ(*distinct_ranks.rbegin(), POKER_HAND_RANK_COUNT);
+
+    EXPECT_EQ(category_counts[StraightFlush], 40);
+    EXPECT_EQ(category_counts[FourOfAKind], 624);
+    EXPECT_EQ(category_counts[FullHouse], 3744);
+    EXPECT_EQ(category_counts[Flush], 5108);
+    EXPECT_EQ(category_counts[Straight], 10200);
+    EXPECT_EQ(category_counts[ThreeOfAKind], 54912);
+    EXPECT_EQ(category_counts[TwoPair], 123552);
+    EXPECT_EQ(category_counts[OnePair], 1098240);
+    EXPECT_EQ(category_counts[HighCard], 1302540);
+}
+
+TEST(PokerHandEvaluatorTests, RankSevenCards) {
+    std::vector<const Card*> hole_cards {
+        Card::get_card(Suit::Hearts, Rank::Ace),
+        Card::get_card(Suit::Hearts, Rank::Two),
+    };
+
+    std::vector<const Card*> community_cards {
+        Card::get_card(Suit::Hearts, Rank::Three),
+        Card::get_card(Suit::Hearts, Rank::Four),
+        Card::get_card(Suit::Hearts, Rank::Five),
+        Card::get_card(Suit::Clubs, Rank::Ace),
+        Card::get_card(Suit::Diamonds, Rank::Ace),
+    };
+
+    PokerHandRank rank = PokerHandRankEvaluator::evaluate(hole_cards, community_cards);
+    PokerHandEvaluation evaluation = PokerHandRankEvaluator::evaluation(rank);
+
+    EXPECT_EQ(evaluation.category, PokerHandEvaluationCategory::StraightFlush);
+    EXPECT_EQ(evaluation.tiebreaker(0), (int)Rank::Five);
+
+    auto [poker_hand, poker_hand_evaluation] = PokerHandEvaluator::evaluate_hand(hole_cards, community_cards);
+    EXPECT_EQ(PokerHandRankEvaluator::evaluate(CardSet(poker_hand.get_cards())), rank);
+
+    // Repeated cards are refused, even five of them.
+    std::vector<const Card*> repeated_cards(5, hole_cards[0]);
+    EXPECT_THROW(PokerHandEvaluator::evaluate_hand(hole_cards, {hole_cards[0], community_cards[0], community_cards[1]}),
+                 std::runtime_error);
+    EXPECT_THROW(PokerHandEvaluator::evaluate_hand({hole_cards[0], hole_cards[0]}, repeated_cards), std::runtime_error);
+    EXPECT_THROW(PokerHandEvaluator::determine_winner(hole_cards, {hole_cards[1], community_cards[4]}, community_cards),
+                 std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, EvaluateBatchMatchesDetermineWinner) {
+    constexpr std::size_t hand_count = 2003;
+
+    std::vector<std::size_t> deck(DECK_SIZE);
+    for (std::size_t i = 0; i < DECK_SIZE; i++) {
+        deck[i] = i;
+    }
+
+    // cards[0..1] are player 1 hole cards, cards[2..3] player 2, cards[4..8] the board.
+    std::vector<std::vector<std::uint8_t>> cards(9, std::vector<std::uint8_t>(hand_count));
+    std::mt19937 gen(2025);
+    for (std::size_t i = 0; i < hand_count; i++) {
+        std::shuffle(deck.begin(), deck.end(), gen);
+        for (std::size_t c = 0; c < cards.size(); c++) {
+            cards[c][i] = static_cast<std::uint8_t>(deck[c]);
+        }
+    }
+
+    for (std::size_t community_card_count = 3; community_card_count <= 5; community_card_count++) {
+        PokerHandBatch player1_batch{{cards[0].data(), cards[1].data()},
+                                     {cards[4].data(), cards[5].data(), cards[6].data(), cards[7].data(), cards[8].data()},
+                                     community_card_count, hand_count};
+        PokerHandBatch player2_batch = player1_batch;
+        player2_batch.hole_cards = {cards[2].data(), cards[3].data()};
+
+        std::vector<PokerHandRank> player1_ranks(hand_count);
+        std::vector<PokerHandRank> player2_ranks(hand_count);
+        PokerHandEvaluator::evaluate_batch(player1_batch, player1_ranks.data());
+        PokerHandEvaluator::evaluate_batch(player2_batch, player2_ranks.data());
+
+        for (std::size_t i = 0; i < hand_count; i++) {
+            auto card = [&](std::size_t c) { return Card::get_card(cards[c][i]); };
+            std::vector<const Card*> player1_hole_cards{card(0), card(1)};
+            std::vector<const Card*> player2_hole_cards{card(2), card(3)};
+            std::vector<const Card*> community_cards{card(4), card(5), card(6), card(7), card(8)};
+            community_cards.resize(community_card_count);
+
+            ASSERT_EQ(player1_ranks[i], PokerHandRankEvaluator::evaluate(player1_hole_cards, community_cards));
+            ASSERT_EQ(player2_ranks[i], PokerHandRankEvaluator::evaluate(player2_hole_cards, community_cards));
+
+            if (community_card_count == 5) {
+                PokerHandWinner winner = PokerHandEvaluator::determine_winner(
+                    player1_hole_cards, player2_hole_cards, community_cards).winner;
+                PokerHandWinner batch_winner = player1_ranks[i] > player2_ranks[i] ? PokerHandWinner::Player1
+                                             : player2_ranks[i] > player1_ranks[i] ? PokerHandWinner::Player2
+                                                                                   : PokerHandWinner::Tie;
+                ASSERT_EQ(batch_winner, winner);
+            }
+        }
+    }
+}
+
+TEST(PokerHandEvaluatorTests, CardSetOperations) {
+    const Card* ace_of_spades = Card::get_card(Suit::Spades, Rank::Ace);
+    const Card* two_of_spades = Card::get_card(Suit::Spades, Rank::Two);
+    const Card* ace_of_hearts = Card::get_card(Suit::Hearts, Rank::Ace);
+
+    CardSet spades(std::vector<const Card*>{ace_of_spades, two_of_spades});
+    CardSet aces(std::vector<const Card*>{ace_of_spades, ace_of_hearts});
+
+    EXPECT_EQ((spades | aces).count(), 3);
+    EXPECT_EQ((spades & aces), CardSet::from_card(ace_of_spades));
+    EXPECT_EQ((spades - aces), CardSet::from_card(two_of_spades));
+    EXPECT_TRUE(spades.intersects(aces));
+    EXPECT_TRUE(spades.contains(two_of_spades));
+    EXPECT_FALSE(spades.contains(ace_of_hearts));
+
+    EXPECT_EQ(spades.suit_mask(Suit::Spades), 0x1001u);
+    EXPECT_EQ(spades.suit_mask(Suit::Hearts), 0u);
+    EXPECT_EQ(aces.rank_mask(), 0x1000u);
+
+    EXPECT_EQ(CardSet::full_deck().count(), DECK_SIZE);
+    EXPECT_EQ(CardSet(CardSet::full_deck().to_cards()), CardSet::full_deck());
+    EXPECT_EQ(CardSet(aces.to_cards()), aces);
+}
+
+TEST(PokerHandEvaluatorTests, CardSetDetermineWinner) {
+    std::vector<const Card*> player1_hole_cards {
+        Card::get_card(Suit::Hearts, Rank::Jack),
+        Card::get_card(Suit::Hearts, Rank::Ten),
+    };
+
+    std::vector<const Card*> player2_hole_cards {
+        Card::get_card(Suit::Hearts, Rank::Queen),
+        Card::get_card(Suit::Hearts, Rank::Three),
+    };
+
+    std::vector<const Card*> community_cards {
+        Card::get_card(Suit::Hearts, Rank::Two),
+        Card::get_card(Suit::Hearts, Rank::Four),
+        Card::get_card(Suit::Hearts, Rank::Seven),
+        Card::get_card(Suit::Clubs, Rank::Nine),
+        Card::get_card(Suit::Diamonds, Rank::Queen),
+    };
+
+    PokerHandResult poker_hand_result = PokerHandEvaluator::determine_winner(
+        CardSet(player1_hole_cards), CardSet(player2_hole_cards), CardSet(community_cards));
+
+    EXPECT_EQ(poker_hand_result.winner, PokerHandWinner::Player2);
+    EXPECT_EQ(poker_hand_result.evaluation.category, PokerHandEvaluationCategory::Flush);
+    EXPECT_EQ(poker_hand_result.evaluation.tiebreaker(0), (int)Rank::Queen);
+    EXPECT_EQ(CardSet(poker_hand_result.hand.value().get_cards()).suit_mask(Suit::Hearts), 0x427u);
+
+    EXPECT_EQ(PokerHandRankEvaluator::evaluate(CardSet(player1_hole_cards) | CardSet(community_cards)),
+              PokerHandRankEvaluator::evaluate(player1_hole_cards, community_cards));
+
+    EXPECT_THROW(PokerHandEvaluator::determine_winner(
+        CardSet(player1_hole_cards), CardSet(player1_hole_cards), CardSet(community_cards)), std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, DetermineWinnersSplitsPots) {
+    std::vector<const Card*> community_cards {
+        Card::get_card(Suit::Clubs, Rank::Ten),
+        Card::get_card(Suit::Hearts, Rank::Jack),
+        Card::get_card(Suit::Diamonds, Rank::Queen),
+        Card::get_card(Suit::Spades, Rank::King),
+        Card::get_card(Suit::Hearts, Rank::Two),
+    };
+    std::vector<std::vector<const Card*>> players_cards {
+        {Card::get_card(Suit::Clubs, Rank::Ace), Card::get_card(Suit::Clubs, Rank::Three)},
+        {Card::get_card(Suit::Hearts, Rank::King), Card::get_card(Suit::Clubs, Rank::King)},
+        {Card::get_card(Suit::Diamonds, Rank::Ace), Card::get_card(Suit::Spades, Rank::Four)},
+        {Card::get_card(Suit::Spades, Rank::Six), Card::get_card(Suit::Spades, Rank::Five)},
+    };
+
+    // Both aces make the broadway straight and split the pot.
+    PokerShowdownResult result = PokerHandEvaluator::determine_winners(players_cards, community_cards);
+    EXPECT_EQ(result.winners, (std::vector<std::size_t>{0, 2}));
+    EXPECT_EQ(result.evaluation.category, Straight);
+
+    // Without them, trip kings win alone.
+    players_cards.erase(players_cards.begin());
+    players_cards.erase(players_cards.begin() + 1);
+    result = PokerHandEvaluator::determine_winners(players_cards, community_cards);
+    EXPECT_EQ(result.winners, (std::vector<std::size_t>{0}));
+    EXPECT_EQ(result.evaluation.category, ThreeOfAKind);
+
+    players_cards.push_back({Card::get_card(Suit::Hearts, Rank::King), Card::get_card(Suit::Clubs, Rank::Two)});
+    EXPECT_THROW(PokerHandEvaluator::determine_winners(players_cards, community_cards), std::runtime_error);
+    EXPECT_THROW(PokerHandEvaluator::determine_winners({players_cards[0]}, community_cards), std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, IncrementalEvaluatorFollowsStreets) {
+    std::vector<const Card*> hole_cards {
+        Card::get_card(Suit::Spades, Rank::Ten),
+        Card::get_card(Suit::Spades, Rank::Nine),
+    };
+
+    std::vector<const Card*> community_cards {
+        Card::get_card(Suit::Spades, Rank::Eight),
+        Card::get_card(Suit::Hearts, Rank::Nine),
+        Card::get_card(Suit::Spades, Rank::Two),
+        Card::get_card(Suit::Spades, Rank::Jack),
+        Card::get_card(Suit::Spades, Rank::Seven),
+    };
+
+    IncrementalPokerHandEvaluator incremental_evaluator(hole_cards);
+    EXPECT_EQ(incremental_evaluator.rank(), 0);
+
+    // Flop, turn and river.
+    std::vector<std::size_t> street_sizes {3, 4, 5};
+    std::vector<PokerHandEvaluationCategory> street_categories {OnePair, Flush, StraightFlush};
+
+    std::vector<const Card*> board;
+    for (std::size_t street = 0; street < street_sizes.size(); street++) {
+        while (board.size() < street_sizes[street]) {
+            const Card* card = community_cards[board.size()];
+            board.push_back(card);
+            incremental_evaluator.add_card(card);
+        }
+
+        // Cards already added are ignored.
+        incremental_evaluator.add_cards(board);
+
+        EXPECT_EQ(incremental_evaluator.card_count(), hole_cards.size() + board.size());
+        EXPECT_EQ(incremental_evaluator.rank(), PokerHandRankEvaluator::evaluate(hole_cards, board));
+        EXPECT_EQ(incremental_evaluator.evaluation().category, street_categories[street]);
+    }
+
+    EXPECT_EQ(incremental_evaluator.evaluation().tiebreaker(0), (int)Rank::Jack);
+}
+
+TEST(PokerHandEvaluatorTests, RankFileMatchesEvaluator) {
+    std::string path = (std::filesystem::temp_directory_path() / "poker_hand_ranks_test.dat").string();
+    PokerHandRankFile::generate(path);
+
+    {
+        PokerHandRankFile rank_file(path);
+
+        std::vector<std::size_t> deck(DECK_SIZE);
+        for (std::size_t i = 0; i < DECK_SIZE; i++) {
+            deck[i] = i;
+        }
+
+        std::mt19937 gen(7);
+        for (int i = 0; i < 30000; i++) {
+            std::shuffle(deck.begin(), deck.end(), gen);
+            CardSet cards;
+            for (std::size_t card_count = 1; card_count <= 7; card_count++) {
+                cards |= CardSet::from_index(deck[card_count - 1]);
+                if (card_count >= 5) {
+                    ASSERT_EQ(rank_file.evaluate(cards), PokerHandRankEvaluator::evaluate(cards));
+                }
+            }
+
+            std::vector<const Card*> hole_cards = CardSet::from_index(deck[0]).to_cards();
+            hole_cards.push_back(Card::get_card(deck[1]));
+            std::vector<const Card*> community_cards = (cards - CardSet(hole_cards)).to_cards();
+            ASSERT_EQ(rank_file.evaluate(hole_cards, community_cards), PokerHandRankEvaluator::evaluate(cards));
+        }
+
+        std::vector<const Card*> hole_cards = {Card::get_card(0), Card::get_card(1)};
+        std::vector<const Card*> community_cards = {Card::get_card(2), Card::get_card(3), Card::get_card(0)};
+        EXPECT_THROW(rank_file.evaluate(hole_cards, community_cards), std::runtime_error);
+    }
+
+    // Any change to the entries fails the checksum.
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(1000);
+        file.put('\x7f');
+    }
+    EXPECT_THROW(PokerHandRankFile rank_file(path), std::runtime_error);
+
+    std::filesystem::remove(path);
+    EXPECT_THROW(PokerHandRankFile rank_file(path), std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, HandIndexerSizes) {
+    EXPECT_EQ(HandIndexer::for_board(0).size(), 169u);
+    EXPECT_EQ(HandIndexer::for_board(3).size(), 1286792u);
+    EXPECT_EQ(HandIndexer::for_board(4).size(), 13960050u);
+    EXPECT_EQ(HandIndexer::for_board(5).size(), 123156254u);
+    EXPECT_EQ(HandIndexer({2, 3, 1}).size(), 55190538u);
+    EXPECT_EQ(HandIndexer({2, 3, 1, 1}).size(), 2428287420u);
+    EXPECT_THROW(HandIndexer::for_board(2), std::runtime_error);
+    EXPECT_THROW(HandIndexer({}), std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, HandIndexerIsDense) {
+    // Every flop index is the canonical situation it unindexes to.
+    const HandIndexer& indexer = HandIndexer::for_board(3);
+    for (std::uint64_t index = 0; index < indexer.size(); index++) {
+        std::vector<CardSet> rounds = indexer.unindex(index);
+        ASSERT_EQ(indexer.index(rounds), index);
+    }
+    EXPECT_THROW(indexer.unindex(indexer.size()), std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, HandIndexerIgnoresSuits) {
+    std::mt19937_64 gen(7);
+    std::array<std::size_t, 4> permutation = {0, 1, 2, 3};
+    auto permute = [&permutation](CardSet cards) {
+        std::uint64_t mask = 0;
+        for (std::size_t suit = 0; suit < suits.size(); suit++) {
+            mask |= std::uint64_t{cards.suit_mask(suits[suit])} << (permutation[suit] * ranks.size());
+        }
+        return CardSet(mask);
+    };
+
+    for (std::size_t board_size : {0, 3, 4, 5}) {
+        const HandIndexer& indexer = HandIndexer::for_board(board_size);
+        std::set<std::uint64_t> indexes;
+        for (int deal = 0; deal < 2000; deal++) {
+            std::vector<std::size_t> deck(DECK_SIZE);
+            std::iota(deck.begin(), deck.end(), 0);
+            std::shuffle(deck.begin(), deck.end(), gen);
+            CardSet hole_cards = CardSet::from_index(deck[0]) | CardSet::from_index(deck[1]);
+            CardSet community_cards;
+            for (std::size_t i = 0; i < board_size; i++) {
+                community_cards |= CardSet::from_index(deck[2 + i]);
+            }
+
+            std::uint64_t index = indexer.index(hole_cards, community_cards);
+            ASSERT_LT(index, indexer.size());
+            indexes.insert(index);
+
+            std::shuffle(permutation.begin(), permutation.end(), gen);
+            EXPECT_EQ(indexer.index(permute(hole_cards), permute(community_cards)), index);
+
+            // The canonical situation is a suit permutation of the original one.
+            std::array<CardSet, 2> rounds = {hole_cards, community_cards};
+            std::vector<CardSet> canonical = indexer.canonicalize(std::span<const CardSet>(rounds.data(), indexer.round_count()));
+            bool found = false;
+            std::sort(permutation.begin(), permutation.end());
+            do {
+                found = found || (permute(hole_cards) == canonical[0]
+                                  && (board_size == 0 || permute(community_cards) == canonical[1]));
+            } while (std::next_permutation(permutation.begin(), permutation.end()));
+            EXPECT_TRUE(found);
+        }
+        // Before the flop, 2000 deals cover most of the 169 classes.
+        EXPECT_GT(indexes.size(), board_size == 0 ? 150u : 1900u);
+    }
+
+    CardSet hole_cards = CardSet::from_index(0) | CardSet::from_index(1);
+    EXPECT_THROW(HandIndexer::for_board(3).index(hole_cards, hole_cards | CardSet::from_index(2)), std::runtime_error);
+    EXPECT_THROW(HandIndexer::for_board(3).index(hole_cards, CardSet::from_index(2)), std::runtime_error);
+}
+
+TEST(PokerHandEvaluatorTests, BoardTextureRanksEveryHolding) {
+    std::vector<const Card*> community_cards {
+        Card::get_card(Suit::Spades, Rank::Ace),
+        Card::get_card(Suit::Spades, Rank::King),
+        Card::get_card(Suit::Spades, Rank::Queen),
+        Card::get_card(Suit::Hearts, Rank::Queen),
+    };
+    BoardTexture texture = BoardTextureAnalyzer::analyze(community_cards);
+    ASSERT_EQ(texture.holdings.size(), 48u * 47 / 2);
+
+    // Only the jack and ten of spades make a royal flush.
+    std::size_t royal_flush = HandRange::combo_index(Card::get_card(Suit::Spades, Rank::Jack)->get_index(),
+                                                     Card::get_card(Suit::Spades, Rank::Ten)->get_index());
+    EXPECT_EQ(texture.nut_combos, std::vector<std::size_t>{royal_flush});
+    EXPECT_EQ(texture.holdings.front().beats, 46u * 45 / 2);
+    EXPECT_EQ(texture.category_counts[StraightFlush], 1u);
+
+    std::size_t category_total = 0;
+    for (std::size_t count : texture.category_counts) {
+        category_total += count;
+    }
+    EXPECT_EQ(category_total, texture.holdings.size());
+
+    // Ranks, and the holdings beaten and tied, checked one by one.
+    CardSet board(community_cards);
+    for (std::size_t i = 0; i < texture.holdings.size(); i++) {
+        const RankedHolding& holding = texture.holdings[i];
+        CardSet cards = HandRange::combo_cards(holding.combo);
+        ASSERT_EQ(holding.rank, PokerHandRankEvaluator::evaluate(cards | board));
+        if (i > 0) {
+            ASSERT_LE(holding.rank, texture.holdings[i - 1].rank);
+        }
+        if (i % 37 != 0) {
+            continue;
+        }
+
+        std::size_t beats = 0;
+        std::size_t ties = 0;
+        for (const RankedHolding& other : texture.holdings) {
+            if (!HandRange::combo_cards(other.combo).intersects(cards)) {
+                beats += holding.rank > other.rank;
+                ties += holding.rank == other.rank;
+            }
+        }
+        EXPECT_EQ(holding.beats, beats);
+        EXPECT_EQ(holding.ties, ties);
+    }
+
+    EXPECT_THROW(BoardTextureAnalyzer::analyze(CardSet::from_index(0) | CardSet::from_index(1)), std::runtime_error);
 }
 
 int main(int argc, char** argv) {
@@ -0,0 +1,122 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace {
+
+// Chunks per thread, so that uneven chunks still keep every thread busy.
+constexpr std::size_t CHUNKS_PER_THREAD = 4;
+
+// Set while the thread runs a chunk of a parallel loop.
+thread_local bool running_chunk = false;
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+    : stopping_(false) {
+    // The calling thread of parallel_for also runs chunks.
+    for (std::size_t i = 1; i < std::max<std::size_t>(thread_count, 1); i++) {
+        workers_.emplace_back(&ThreadPool::run_worker, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    task_available_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+std::size_t ThreadPool::thread_count() const {
+    return workers_.size() + 1;
+}
+
+void ThreadPool::parallel_for(std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& body) {
+    if (count == 0) {
+        return;
+    }
+
+    std::size_t chunk_count = std::min(count, thread_count() * CHUNKS_PER_THREAD);
+    if (chunk_count == 1 || running_chunk) {
+        body(0, count);
+        return;
+    }
+
+    std::atomic<std::size_t> remaining(chunk_count);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t chunk = 0; chunk < chunk_count; chunk++) {
+            std::size_t begin = count * chunk / chunk_count;
+            std::size_t end = count * (chunk + 1) / chunk_count;
+            tasks_.emplace_back([&, begin, end] {
+                running_chunk = true;
+                try {
+                    body(begin, end);
+                } catch (...) {
+                    std::lock_guard<std::mutex> error_lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                running_chunk = false;
+                remaining--;
+            });
+        }
+    }
+    task_available_.notify_all();
+
+    // Help with the queue (which may hold chunks of other top level loops too) until done.
+    while (remaining > 0) {
+        if (!run_pending_task()) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::run_worker() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_available_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
+
+bool ThreadPool::run_pending_task() {
+    std::function<void()> task;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+            return false;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+    }
+    task();
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads running the chunks of parallel loops.
+class ThreadPool {
+public:
+    // Defaults to one thread per hardware thread.
+    explicit ThreadPool(std::size_t thread_count = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Pool shared by the whole process.
+    static ThreadPool& shared();
+
+    std::size_t thread_count() const;
+
+    // Call body(begin, end) on disjoint ranges covering [0, count), spread over the
+    // workers and the calling thread, and wait for all of them. The first exception
+    // thrown by body is rethrown here. Called from inside a chunk of any pool, the
+    // loop runs inline instead, so a chunk never picks up unrelated work.
+    void parallel_for(std::size_t count, const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+private:
+    void run_worker();
+    // Run one queued task if there is one. Returns false if the queue was empty.
+    bool run_pending_task();
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable task_available_;
+    bool stopping_;
+};
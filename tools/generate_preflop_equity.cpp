@@ -0,0 +1,22 @@
+#include "../preflop_equity.hpp"
+
+#include <chrono>
+#include <iostream>
+
+// Writes the preflop equity table compiled into PreflopEquity.
+// Usage: generate_preflop_equity [path]
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : PreflopEquity::DEFAULT_PATH;
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        PreflopEquity::generate(path);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "Wrote " << PreflopEquity::CLASS_COUNT << " preflop classes to " << path
+                  << " in " << elapsed.count() << " s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
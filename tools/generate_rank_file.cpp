@@ -0,0 +1,23 @@
+#include "../poker_hand_rank_file.hpp"
+
+#include <chrono>
+#include <iostream>
+
+// Writes the precomputed poker hand rank file used by PokerHandEvaluator when present.
+// Usage: generate_rank_file [path]
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : PokerHandRankFile::DEFAULT_PATH;
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+        PokerHandRankFile::generate(path);
+        PokerHandRankFile rank_file(path);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "Wrote " << rank_file.state_count() << " states to " << path
+                  << " in " << elapsed.count() << " s" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
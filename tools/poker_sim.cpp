@@ -0,0 +1,75 @@
+#include "../poker_simulator.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr std::uint64_t DEFAULT_HANDS = 1000000;
+
+Difficulty parse_difficulty(const std::string& name) {
+    if (name == "easy") {
+        return Difficulty::Easy;
+    }
+    if (name == "medium") {
+        return Difficulty::Medium;
+    }
+    if (name == "hard") {
+        return Difficulty::Hard;
+    }
+    throw std::runtime_error("Unknown difficulty " + name + ", expected easy, medium or hard.");
+}
+
+double microseconds_per(std::chrono::nanoseconds time, std::uint64_t count) {
+    return count > 0 ? std::chrono::duration<double, std::micro>(time).count() / count : 0.0;
+}
+
+void print_result(const SimulationResult& result, const std::string& first, const std::string& second) {
+    const std::array<const char*, SimulationResult::STREET_COUNT> street_names = {"preflop", "flop", "turn", "river"};
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::cout << result.hands << " hands in " << std::chrono::duration<double>(result.elapsed).count() << " s, "
+              << result.hands_per_second() << " hands/s, " << result.rebuys << " rebuys" << std::endl;
+    std::cout << first << " wins " << 100 * result.win_rate(0) << "%, "
+              << second << " wins " << 100 * result.win_rate(1) << "%, ties "
+              << (result.hands > 0 ? 100.0 * result.ties / result.hands : 0.0) << "%" << std::endl;
+    std::cout << first << " net " << result.net_chips[0] << " chips, "
+              << second << " net " << result.net_chips[1] << " chips" << std::endl;
+    std::cout << "average pot " << result.average_pot() << ", showdowns "
+              << (result.hands > 0 ? 100.0 * result.showdowns / result.hands : 0.0) << "%" << std::endl;
+
+    // Street times add up the time of every table.
+    std::cout << "deal: " << microseconds_per(result.deal_time, result.hands) << " us/hand" << std::endl;
+    for (std::size_t street = 0; street < result.streets.size(); street++) {
+        const SimulationStreet& timing = result.streets[street];
+        std::cout << street_names[street] << ": " << timing.actions << " actions, "
+                  << microseconds_per(timing.decision_time, timing.actions) << " us/decision, "
+                  << microseconds_per(timing.engine_time, timing.actions) << " us/engine move" << std::endl;
+    }
+}
+
+} // namespace
+
+// Plays computer players against each other and reports the results.
+// Usage: poker_sim [hands] [first difficulty] [second difficulty] [tables] [seed]
+// Tables default to one per hardware thread. The seed, random by default, is
+// printed so that the same cards can be dealt again.
+int main(int argc, char* argv[]) {
+    try {
+        std::uint64_t hands = argc > 1 ? std::stoull(argv[1]) : DEFAULT_HANDS;
+        std::string first = argc > 2 ? argv[2] : "easy";
+        std::string second = argc > 3 ? argv[3] : "medium";
+        std::size_t tables = argc > 4 ? std::stoul(argv[4]) : 0;
+        std::uint64_t seed = argc > 5 ? std::stoull(argv[5]) : Xoshiro256::random_seed();
+
+        MultiTableSimulator simulator(parse_difficulty(first), parse_difficulty(second), tables, seed);
+        std::cout << "Playing on " << simulator.table_count() << " tables with seed " << seed << std::endl;
+        print_result(simulator.run(hands), first, second);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+// xoshiro256** generator (Blackman and Vigna): 32 bytes of state and a few
+// instructions per number. The same seed always gives the same numbers, so games
+// dealt from it can be replayed. Usable with the <random> distributions.
+class Xoshiro256 {
+public:
+    using result_type = std::uint64_t;
+
+    // The state is expanded from the seed with splitmix64, so nearby seeds still
+    // give unrelated sequences.
+    explicit Xoshiro256(std::uint64_t seed) {
+        for (std::uint64_t& word : state) {
+            seed += 0x9E3779B97F4A7C15ull;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    // Seed for a generator that isn't meant to be replayed.
+    static std::uint64_t random_seed() {
+        std::random_device device;
+        return (std::uint64_t{device()} << 32) | device();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        const std::uint64_t result = std::rotl(state[1] * 5, 7) * 9;
+        const std::uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = std::rotl(state[3], 45);
+        return result;
+    }
+
+    // Uniform value in [0, bound), without modulo bias (Lemire's method).
+    std::uint64_t bounded(std::uint64_t bound) {
+        std::uint64_t low;
+        std::uint64_t high = multiply((*this)(), bound, low);
+        if (low < bound) {
+            const std::uint64_t threshold = (0 - bound) % bound;
+            while (low < threshold) {
+                high = multiply((*this)(), bound, low);
+            }
+        }
+        return high;
+    }
+
+private:
+    // Full 128-bit product of a and b: returns the high word and stores the low one.
+    static std::uint64_t multiply(std::uint64_t a, std::uint64_t b, std::uint64_t& low) {
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+        low = static_cast<std::uint64_t>(product);
+        return static_cast<std::uint64_t>(product >> 64);
+#else
+        // Four 32x32 bit partial products.
+        const std::uint64_t a_low = a & 0xFFFFFFFFull, a_high = a >> 32;
+        const std::uint64_t b_low = b & 0xFFFFFFFFull, b_high = b >> 32;
+        const std::uint64_t low_low = a_low * b_low;
+        const std::uint64_t high_low = a_high * b_low;
+        const std::uint64_t low_high = a_low * b_high;
+        const std::uint64_t high_high = a_high * b_high;
+        const std::uint64_t middle = (low_low >> 32) + (high_low & 0xFFFFFFFFull) + low_high;
+        low = (middle << 32) | (low_low & 0xFFFFFFFFull);
+        return high_high + (high_low >> 32) + (middle >> 32);
+#endif
+    }
+
+    std::array<std::uint64_t, 4> state;
+};